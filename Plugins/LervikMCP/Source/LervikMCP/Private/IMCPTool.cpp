@@ -8,3 +8,8 @@ FName IMCPTool::GetModularFeatureName()
     static const FName Name(TEXT("MCPTool"));
     return Name;
 }
+
+TFuture<FMCPToolResult> IMCPTool::ExecuteAsync(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context)
+{
+    return MakeFulfilledPromise<FMCPToolResult>(Execute(Params)).GetFuture();
+}
@@ -1,9 +1,12 @@
 #include "LervikMCPModule.h"
 #include "MCPServer.h"
+#include "MCPGameThreadQueue.h"
+#include "MCPPropertyPlanCache.h"
 #include "HAL/IConsoleManager.h"
 #include "Async/Async.h"
 #include "Tools/MCPTool_Execute.h"
 #include "Tools/MCPTool_Trace.h"
+#include "Tools/TraceAnalyzer.h"
 #include "Features/IModularFeatures.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogLervikMCP, Log, All);
@@ -21,6 +24,7 @@ static TAutoConsoleVariable<int32> CVarMcpPort(
 void FLervikMCPModule::StartupModule()
 {
     FModuleManager::Get().LoadModuleChecked(TEXT("HTTPServer"));
+    FMCPGameThreadQueue::Get().Startup();
 
     FConsoleVariableDelegate OnCVarChanged = FConsoleVariableDelegate::CreateLambda([this](IConsoleVariable*)
     {
@@ -71,6 +75,10 @@ void FLervikMCPModule::ShutdownModule()
         Server.Reset();
     }
 
+    FMCPGameThreadQueue::Get().Shutdown();
+    FMCPPropertyPlanCache::Get().Shutdown();
+    FTraceAnalyzer::ResetCache();
+
     if (StatusCommand)
     {
         IConsoleManager::Get().UnregisterConsoleObject(StatusCommand);
@@ -152,16 +160,20 @@ void FLervikMCPModule::HandleStatusCommand(const TArray<FString>& Args)
     if (Server.IsValid() && Server->IsRunning())
     {
         UE_LOG(LogLervikMCP, Log, TEXT("MCP server: RUNNING on port %u"), Server->GetPort());
-        TOptional<FMCPSession> Snapshot = Server->GetSessionSnapshot();
-        if (Snapshot.IsSet())
-        {
-            UE_LOG(LogLervikMCP, Log, TEXT("  Session: %s (client: %s %s)"),
-                *Snapshot->SessionId.ToString(EGuidFormats::DigitsWithHyphens),
-                *Snapshot->ClientName, *Snapshot->ClientVersion);
-        }
-        else
+        const FMCPWorkerPool& Pool = Server->GetWorkerPool();
+        UE_LOG(LogLervikMCP, Log, TEXT("  Workers: %d/%d busy, queue depth %d/%d"),
+            Pool.GetActiveCount(), Pool.GetNumWorkers(), Pool.GetQueueDepth(), Pool.GetMaxQueueDepth());
+        UE_LOG(LogLervikMCP, Log, TEXT("  Game thread queue: %d pending"), FMCPGameThreadQueue::Get().GetPendingCount());
+        const FMCPRequestMetrics& Metrics = Server->GetRequestMetrics();
+        UE_LOG(LogLervikMCP, Log, TEXT("  Requests: %lld (%lld bytes), parse avg %.3f ms, max %.3f ms"),
+            Metrics.GetRequestCount(), Metrics.GetBodyBytes(), Metrics.GetAverageParseMs(), Metrics.GetMaxParseMs());
+        const TArray<FMCPSession> Sessions = Server->GetSessionSnapshots();
+        UE_LOG(LogLervikMCP, Log, TEXT("  Sessions: %d"), Sessions.Num());
+        for (const FMCPSession& Session : Sessions)
         {
-            UE_LOG(LogLervikMCP, Log, TEXT("  No active session"));
+            UE_LOG(LogLervikMCP, Log, TEXT("    %s (client: %s %s)"),
+                *Session.SessionId.ToString(EGuidFormats::DigitsWithHyphens),
+                Session.ClientName.IsEmpty() ? TEXT("<static>") : *Session.ClientName, *Session.ClientVersion);
         }
     }
     else
@@ -0,0 +1,222 @@
+#include "MCPCompactGuidTable.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace
+{
+    const TCHAR Base64UrlAlphabet[] = TEXT("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_");
+
+    /** 6-bit value of a base64 or base64url character, or -1. */
+    int32 DecodeChar(TCHAR C)
+    {
+        if (C >= TEXT('A') && C <= TEXT('Z')) return C - TEXT('A');
+        if (C >= TEXT('a') && C <= TEXT('z')) return C - TEXT('a') + 26;
+        if (C >= TEXT('0') && C <= TEXT('9')) return C - TEXT('0') + 52;
+        if (C == TEXT('-') || C == TEXT('+')) return 62;
+        if (C == TEXT('_') || C == TEXT('/')) return 63;
+        return -1;
+    }
+}
+
+FMCPCompactGuidTable::FMCPCompactGuidTable()
+{
+    for (TAtomic<FSlot*>& Chunk : Chunks)
+    {
+        Chunk = nullptr;
+    }
+}
+
+FMCPCompactGuidTable::~FMCPCompactGuidTable()
+{
+    for (TAtomic<FSlot*>& Chunk : Chunks)
+    {
+        delete[] Chunk.Load();
+    }
+}
+
+int32 FMCPCompactGuidTable::FindOrAdd(const FGuid& Guid)
+{
+    FShard& Shard = Shards[GetTypeHash(Guid) % NumShards];
+    {
+        FReadScopeLock ReadLock(Shard.Lock);
+        if (const int32* Found = Shard.Indices.Find(Guid))
+        {
+            return *Found;
+        }
+    }
+
+    FWriteScopeLock WriteLock(Shard.Lock);
+    if (const int32* Found = Shard.Indices.Find(Guid))
+    {
+        return *Found;
+    }
+
+    const int32 Index = NextIndex.IncrementExchange();
+    if (Index < 0 || Index >= MaxChunks * ChunkSize)
+    {
+        return INDEX_NONE;
+    }
+
+    FSlot& Slot = GetOrCreateChunk(Index >> ChunkBits)[Index & (ChunkSize - 1)];
+    Slot.Guid = Guid;
+    Slot.bReady = true;
+    Shard.Indices.Add(Guid, Index);
+    return Index;
+}
+
+FGuid FMCPCompactGuidTable::Get(int32 Index) const
+{
+    if (Index < 0 || Index >= MaxChunks * ChunkSize)
+    {
+        return FGuid();
+    }
+
+    const FSlot* Chunk = Chunks[Index >> ChunkBits].Load();
+    if (!Chunk)
+    {
+        return FGuid();
+    }
+
+    const FSlot& Slot = Chunk[Index & (ChunkSize - 1)];
+    return Slot.bReady.Load() ? Slot.Guid : FGuid();
+}
+
+int32 FMCPCompactGuidTable::Num() const
+{
+    return FMath::Min(NextIndex.Load(), MaxChunks * ChunkSize);
+}
+
+void FMCPCompactGuidTable::Reset()
+{
+    // Holding every shard lock stops FindOrAdd from handing out indices while they are cleared.
+    for (FShard& Shard : Shards)
+    {
+        Shard.Lock.WriteLock();
+    }
+
+    const int32 Count = Num();
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        if (FSlot* Chunk = Chunks[Index >> ChunkBits].Load())
+        {
+            Chunk[Index & (ChunkSize - 1)].bReady = false;
+        }
+    }
+    NextIndex = 0;
+
+    for (FShard& Shard : Shards)
+    {
+        Shard.Indices.Reset();
+        Shard.Lock.WriteUnlock();
+    }
+}
+
+FMCPCompactGuidTable::FSlot* FMCPCompactGuidTable::GetOrCreateChunk(int32 ChunkIndex)
+{
+    FSlot* Chunk = Chunks[ChunkIndex].Load();
+    if (Chunk)
+    {
+        return Chunk;
+    }
+
+    // Writers in different shards can race to create the same chunk; the loser frees its copy.
+    FSlot* NewChunk = new FSlot[ChunkSize];
+    FSlot* Expected = nullptr;
+    if (Chunks[ChunkIndex].CompareExchange(Expected, NewChunk))
+    {
+        return NewChunk;
+    }
+    delete[] NewChunk;
+    return Expected;
+}
+
+FString FMCPCompactGuidTable::ToCompact(const FGuid& Guid)
+{
+    const int32 Index = FindOrAdd(Guid);
+    if (Index == INDEX_NONE)
+    {
+        return Guid.ToString(EGuidFormats::Digits);
+    }
+
+    TCHAR Buffer[MaxCompactLen];
+    const int32 Len = EncodeIndex(Index, Buffer);
+    return FString(FStringView(Buffer, Len));
+}
+
+FGuid FMCPCompactGuidTable::FromCompact(FStringView Compact) const
+{
+    // Raw GUIDs are still accepted, e.g. from before compact IDs or from a full table.
+    if (Compact.Len() == 32)
+    {
+        FGuid RawGuid;
+        if (FGuid::Parse(FString(Compact), RawGuid))
+        {
+            return RawGuid;
+        }
+    }
+
+    int32 Index = 0;
+    return DecodeIndex(Compact, Index) ? Get(Index) : FGuid();
+}
+
+int32 FMCPCompactGuidTable::EncodeIndex(int32 Index, TCHAR* OutChars)
+{
+    const uint32 Value = (uint32)FMath::Max(Index, 0);
+    const int32 NumBytes = Value > 0xFFFFFF ? 4 : Value > 0xFFFF ? 3 : Value > 0xFF ? 2 : 1;
+
+    uint8 Bytes[4];
+    for (int32 i = 0; i < NumBytes; ++i)
+    {
+        Bytes[i] = (uint8)(Value >> (8 * (NumBytes - 1 - i)));
+    }
+
+    int32 Len = 0;
+    for (int32 i = 0; i < NumBytes; i += 3)
+    {
+        const int32 Remaining = NumBytes - i;
+        const uint32 Group = ((uint32)Bytes[i] << 16)
+            | (Remaining > 1 ? (uint32)Bytes[i + 1] << 8 : 0)
+            | (Remaining > 2 ? (uint32)Bytes[i + 2] : 0);
+
+        OutChars[Len++] = Base64UrlAlphabet[(Group >> 18) & 63];
+        OutChars[Len++] = Base64UrlAlphabet[(Group >> 12) & 63];
+        if (Remaining > 1) OutChars[Len++] = Base64UrlAlphabet[(Group >> 6) & 63];
+        if (Remaining > 2) OutChars[Len++] = Base64UrlAlphabet[Group & 63];
+    }
+    return Len;
+}
+
+bool FMCPCompactGuidTable::DecodeIndex(FStringView Compact, int32& OutIndex)
+{
+    // Older IDs were padded base64 with the '=' stripped; tolerate leftover padding too.
+    while (Compact.Len() > 0 && Compact[Compact.Len() - 1] == TEXT('='))
+    {
+        Compact.LeftChopInline(1);
+    }
+
+    const int32 Len = Compact.Len();
+    if (Len < 2 || Len > MaxCompactLen || Len % 4 == 1)
+    {
+        return false;
+    }
+
+    uint64 Bits = 0;
+    for (const TCHAR C : Compact)
+    {
+        const int32 Value = DecodeChar(C);
+        if (Value < 0)
+        {
+            return false;
+        }
+        Bits = (Bits << 6) | (uint64)Value;
+    }
+
+    // Drop the filler bits of the last partial byte.
+    Bits >>= (Len * 6) % 8;
+    if (Bits > (uint64)MAX_int32)
+    {
+        return false;
+    }
+
+    OutIndex = (int32)Bits;
+    return true;
+}
@@ -0,0 +1,105 @@
+#include "MCPGameThreadQueue.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarMcpGameThreadBudgetMs(
+    TEXT("mcp.gamethread_budget_ms"), 5.0f,
+    TEXT("Max milliseconds per frame spent running queued MCP game-thread work. At least one item always runs per frame"),
+    ECVF_Default);
+
+FMCPGameThreadQueue& FMCPGameThreadQueue::Get()
+{
+    static FMCPGameThreadQueue Instance;
+    return Instance;
+}
+
+void FMCPGameThreadQueue::Startup()
+{
+    check(IsInGameThread());
+    if (bRunning.Load())
+    {
+        return;
+    }
+
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateRaw(this, &FMCPGameThreadQueue::Tick));
+    bRunning = true;
+}
+
+void FMCPGameThreadQueue::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bRunning.Load())
+    {
+        return;
+    }
+
+    bRunning = false;
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    TickerHandle.Reset();
+
+    // Callers may be blocked on a future from this queue; never leave work behind.
+    PumpAll();
+}
+
+bool FMCPGameThreadQueue::IsRunning() const
+{
+    return bRunning.Load();
+}
+
+void FMCPGameThreadQueue::Enqueue(TUniqueFunction<void()>&& Work)
+{
+    if (!bRunning.Load())
+    {
+        AsyncTask(ENamedThreads::GameThread, MoveTemp(Work));
+        return;
+    }
+
+    ++PendingCount;
+    Queue.Enqueue(MoveTemp(Work));
+
+    // Shutdown may have drained the queue between the check above and the enqueue.
+    if (!bRunning.Load())
+    {
+        AsyncTask(ENamedThreads::GameThread, [this]() { PumpAll(); });
+    }
+}
+
+int32 FMCPGameThreadQueue::Pump(double BudgetSeconds)
+{
+    check(IsInGameThread());
+
+    const double EndTime = FPlatformTime::Seconds() + BudgetSeconds;
+    int32 NumRun = 0;
+    TUniqueFunction<void()> Work;
+    while (Queue.Dequeue(Work))
+    {
+        --PendingCount;
+        Work();
+        Work.Reset();
+        ++NumRun;
+
+        if (FPlatformTime::Seconds() >= EndTime)
+        {
+            break;
+        }
+    }
+    return NumRun;
+}
+
+int32 FMCPGameThreadQueue::PumpAll()
+{
+    return Pump(TNumericLimits<double>::Max());
+}
+
+int32 FMCPGameThreadQueue::GetPendingCount() const
+{
+    return PendingCount.Load();
+}
+
+bool FMCPGameThreadQueue::Tick(float DeltaTime)
+{
+    const double BudgetSeconds = FMath::Max(0.0f, CVarMcpGameThreadBudgetMs.GetValueOnGameThread()) / 1000.0;
+    Pump(BudgetSeconds);
+    return true;
+}
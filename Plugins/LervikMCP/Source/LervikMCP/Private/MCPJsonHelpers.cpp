@@ -2,7 +2,7 @@
 #include "UObject/TextProperty.h"
 #include "UObject/EnumProperty.h"
 #include "Misc/EngineVersionComparison.h"
-#include "MCPSearchPatterns.h"
+#include "MCPPropertyPlanCache.h"
 #include "MCPServer.h"
 #include "LervikMCPModule.h"
 
@@ -89,22 +89,25 @@ TSharedPtr<FJsonValue> FMCPJsonHelpers::PropertyToJsonValue(FProperty* Prop, con
 
 TSharedPtr<FJsonObject> FMCPJsonHelpers::UObjectToJson(UObject* Obj, const FString& Filter, bool bSkipDefaults)
 {
-    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
     if (!Obj)
     {
-        return Result;
+        return MakeShared<FJsonObject>();
     }
 
+    FMCPPropertyPlanCache& PlanCache = FMCPPropertyPlanCache::Get();
+    if (TSharedPtr<FJsonObject> Snapshot = PlanCache.FindSnapshot(Obj, Filter, bSkipDefaults))
+    {
+        return Snapshot;
+    }
+
+    TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
     UObject* Archetype = bSkipDefaults ? Obj->GetArchetype() : nullptr;
+    const TSharedRef<FMCPPropertyPlan> Plan = PlanCache.GetPlan(Obj->GetClass());
 
-    for (TFieldIterator<FProperty> It(Obj->GetClass()); It; ++It)
+    const TSharedRef<const FMCPPropertyPlan::FEntryList> Entries = Plan->GetEntries(Filter);
+    for (const FMCPPropertyPlanEntry* Entry : *Entries)
     {
-        FProperty* Prop = *It;
-        if (!Filter.IsEmpty() && !FMCPSearchPatterns::Matches(Filter, Prop->GetName()))
-        {
-            continue;
-        }
-
+        FProperty* Prop = Entry->Property;
         const void* ValuePtr = Prop->ContainerPtrToValuePtr<void>(Obj);
 
         if (Archetype)
@@ -117,10 +120,11 @@ TSharedPtr<FJsonObject> FMCPJsonHelpers::UObjectToJson(UObject* Obj, const FStri
         TSharedPtr<FJsonValue> JsonValue = PropertyToJsonValue(Prop, ValuePtr);
         if (JsonValue.IsValid())
         {
-            Result->SetField(Prop->GetName(), JsonValue);
+            Result->SetField(Entry->JsonKey, JsonValue);
         }
     }
 
+    PlanCache.AddSnapshot(Obj, Filter, bSkipDefaults, Result);
     return Result;
 }
 
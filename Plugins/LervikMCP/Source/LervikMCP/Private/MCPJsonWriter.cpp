@@ -0,0 +1,349 @@
+#include "MCPJsonWriter.h"
+
+namespace
+{
+    const ANSICHAR HexDigits[] = "0123456789abcdef";
+
+    /** Escape sequence for an ASCII character, or nullptr if it can be written as is. */
+    const ANSICHAR* GetAsciiEscape(uint32 Char)
+    {
+        switch (Char)
+        {
+        case '"':  return "\\\"";
+        case '\\': return "\\\\";
+        case '\b': return "\\b";
+        case '\f': return "\\f";
+        case '\n': return "\\n";
+        case '\r': return "\\r";
+        case '\t': return "\\t";
+        default:   return nullptr;
+        }
+    }
+
+    void AppendControlEscape(TArray<uint8>& Buffer, uint32 Char)
+    {
+        const uint8 Escape[] = { '\\', 'u', '0', '0', (uint8)HexDigits[(Char >> 4) & 0xF], (uint8)HexDigits[Char & 0xF] };
+        Buffer.Append(Escape, UE_ARRAY_COUNT(Escape));
+    }
+
+    void AppendCodepoint(TArray<uint8>& Buffer, uint32 Codepoint)
+    {
+        if (Codepoint < 0x80)
+        {
+            Buffer.Add((uint8)Codepoint);
+        }
+        else if (Codepoint < 0x800)
+        {
+            Buffer.Add((uint8)(0xC0 | (Codepoint >> 6)));
+            Buffer.Add((uint8)(0x80 | (Codepoint & 0x3F)));
+        }
+        else if (Codepoint < 0x10000)
+        {
+            Buffer.Add((uint8)(0xE0 | (Codepoint >> 12)));
+            Buffer.Add((uint8)(0x80 | ((Codepoint >> 6) & 0x3F)));
+            Buffer.Add((uint8)(0x80 | (Codepoint & 0x3F)));
+        }
+        else
+        {
+            Buffer.Add((uint8)(0xF0 | (Codepoint >> 18)));
+            Buffer.Add((uint8)(0x80 | ((Codepoint >> 12) & 0x3F)));
+            Buffer.Add((uint8)(0x80 | ((Codepoint >> 6) & 0x3F)));
+            Buffer.Add((uint8)(0x80 | (Codepoint & 0x3F)));
+        }
+    }
+}
+
+FMCPJsonWriter::FMCPJsonWriter(int32 ReserveBytes)
+{
+    Buffer.Reserve(ReserveBytes);
+}
+
+void FMCPJsonWriter::BeginValue()
+{
+    if (bAfterKey)
+    {
+        bAfterKey = false;
+        return;
+    }
+
+    if (ScopeHasElements.Num() > 0)
+    {
+        bool& bHasElements = ScopeHasElements.Last();
+        if (bHasElements)
+        {
+            Buffer.Add(',');
+        }
+        bHasElements = true;
+    }
+}
+
+void FMCPJsonWriter::BeginObject()
+{
+    BeginValue();
+    Buffer.Add('{');
+    ScopeHasElements.Add(false);
+}
+
+void FMCPJsonWriter::EndObject()
+{
+    check(ScopeHasElements.Num() > 0 && !bAfterKey);
+    ScopeHasElements.Pop();
+    Buffer.Add('}');
+}
+
+void FMCPJsonWriter::BeginArray()
+{
+    BeginValue();
+    Buffer.Add('[');
+    ScopeHasElements.Add(false);
+}
+
+void FMCPJsonWriter::EndArray()
+{
+    check(ScopeHasElements.Num() > 0 && !bAfterKey);
+    ScopeHasElements.Pop();
+    Buffer.Add(']');
+}
+
+void FMCPJsonWriter::WriteKey(FAnsiStringView Key)
+{
+    check(!bAfterKey);
+    BeginValue();
+    Buffer.Add('"');
+    AppendEscaped(TConstArrayView<uint8>(reinterpret_cast<const uint8*>(Key.GetData()), Key.Len()));
+    Buffer.Add('"');
+    Buffer.Add(':');
+    bAfterKey = true;
+}
+
+void FMCPJsonWriter::WriteKey(FStringView Key)
+{
+    check(!bAfterKey);
+    BeginValue();
+    Buffer.Add('"');
+    AppendEscaped(Key);
+    Buffer.Add('"');
+    Buffer.Add(':');
+    bAfterKey = true;
+}
+
+void FMCPJsonWriter::WriteString(FStringView Value)
+{
+    BeginValue();
+    Buffer.Add('"');
+    AppendEscaped(Value);
+    Buffer.Add('"');
+}
+
+void FMCPJsonWriter::WriteString(FAnsiStringView Value)
+{
+    WriteUtf8String(TConstArrayView<uint8>(reinterpret_cast<const uint8*>(Value.GetData()), Value.Len()));
+}
+
+void FMCPJsonWriter::WriteUtf8String(TConstArrayView<uint8> Utf8)
+{
+    BeginValue();
+    Buffer.Add('"');
+    AppendEscaped(Utf8);
+    Buffer.Add('"');
+}
+
+void FMCPJsonWriter::WriteNumber(double Value)
+{
+    if (FMath::Abs(Value) < 9007199254740992.0 && Value == FMath::RoundToDouble(Value))
+    {
+        WriteInteger((int64)Value);
+        return;
+    }
+
+    BeginValue();
+    if (!FMath::IsFinite(Value))
+    {
+        // JSON has no representation for NaN/Inf
+        AppendAnsi("null");
+        return;
+    }
+    const FString Number = FString::SanitizeFloat(Value);
+    for (TCHAR Char : Number)
+    {
+        Buffer.Add((uint8)Char);
+    }
+}
+
+void FMCPJsonWriter::WriteInteger(int64 Value)
+{
+    BeginValue();
+    ANSICHAR Digits[24];
+    const int32 Len = FCStringAnsi::Snprintf(Digits, UE_ARRAY_COUNT(Digits), "%lld", (long long)Value);
+    AppendAnsi(FAnsiStringView(Digits, Len));
+}
+
+void FMCPJsonWriter::WriteFixed(double Value, int32 Decimals)
+{
+    BeginValue();
+    if (!FMath::IsFinite(Value))
+    {
+        AppendAnsi("null");
+        return;
+    }
+    ANSICHAR Digits[64];
+    const int32 Len = FCStringAnsi::Snprintf(Digits, UE_ARRAY_COUNT(Digits), "%.*f", FMath::Clamp(Decimals, 0, 9), Value);
+    AppendAnsi(FAnsiStringView(Digits, FMath::Clamp(Len, 0, (int32)UE_ARRAY_COUNT(Digits) - 1)));
+}
+
+void FMCPJsonWriter::WriteBool(bool bValue)
+{
+    BeginValue();
+    AppendAnsi(bValue ? "true" : "false");
+}
+
+void FMCPJsonWriter::WriteNull()
+{
+    BeginValue();
+    AppendAnsi("null");
+}
+
+void FMCPJsonWriter::WriteRawValue(TConstArrayView<uint8> Utf8Json)
+{
+    BeginValue();
+    if (Utf8Json.Num() > 0)
+    {
+        Buffer.Append(Utf8Json.GetData(), Utf8Json.Num());
+    }
+    else
+    {
+        AppendAnsi("null");
+    }
+}
+
+void FMCPJsonWriter::WriteValue(const TSharedPtr<FJsonValue>& Value)
+{
+    if (!Value.IsValid())
+    {
+        WriteNull();
+        return;
+    }
+
+    switch (Value->Type)
+    {
+    case EJson::String:
+        WriteString(Value->AsString());
+        break;
+    case EJson::Number:
+        WriteNumber(Value->AsNumber());
+        break;
+    case EJson::Boolean:
+        WriteBool(Value->AsBool());
+        break;
+    case EJson::Array:
+        BeginArray();
+        for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+        {
+            WriteValue(Element);
+        }
+        EndArray();
+        break;
+    case EJson::Object:
+        WriteObject(Value->AsObject());
+        break;
+    default:
+        WriteNull();
+        break;
+    }
+}
+
+void FMCPJsonWriter::WriteObject(const TSharedPtr<FJsonObject>& Object)
+{
+    if (!Object.IsValid())
+    {
+        WriteNull();
+        return;
+    }
+
+    BeginObject();
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Object->Values)
+    {
+        WriteKey(Field.Key);
+        WriteValue(Field.Value);
+    }
+    EndObject();
+}
+
+TArray<uint8> FMCPJsonWriter::Take()
+{
+    ScopeHasElements.Reset();
+    bAfterKey = false;
+    return MoveTemp(Buffer);
+}
+
+void FMCPJsonWriter::AppendAnsi(FAnsiStringView Text)
+{
+    Buffer.Append(reinterpret_cast<const uint8*>(Text.GetData()), Text.Len());
+}
+
+// No up-front Reserve in the escapers: an exact reserve per call pins capacity to the current
+// size, so every later append reallocates. TArray's own growth keeps appends amortized.
+void FMCPJsonWriter::AppendEscaped(FStringView Value)
+{
+    const TCHAR* Data = Value.GetData();
+    const int32 Len = Value.Len();
+    for (int32 i = 0; i < Len; ++i)
+    {
+        uint32 Char = (uint32)Data[i];
+        if (Char < 0x80)
+        {
+            if (const ANSICHAR* Escape = GetAsciiEscape(Char))
+            {
+                AppendAnsi(Escape);
+            }
+            else if (Char < 0x20)
+            {
+                AppendControlEscape(Buffer, Char);
+            }
+            else
+            {
+                Buffer.Add((uint8)Char);
+            }
+            continue;
+        }
+
+        // UTF-16 builds store characters outside the BMP as surrogate pairs
+        if (Char >= 0xD800 && Char <= 0xDBFF && i + 1 < Len && (uint32)Data[i + 1] >= 0xDC00 && (uint32)Data[i + 1] <= 0xDFFF)
+        {
+            Char = 0x10000 + ((Char - 0xD800) << 10) + ((uint32)Data[i + 1] - 0xDC00);
+            ++i;
+        }
+        else if ((Char >= 0xD800 && Char <= 0xDFFF) || Char > 0x10FFFF)
+        {
+            Char = 0xFFFD;
+        }
+        AppendCodepoint(Buffer, Char);
+    }
+}
+
+void FMCPJsonWriter::AppendEscaped(TConstArrayView<uint8> Utf8)
+{
+    // Multi-byte sequences never contain bytes below 0x80, so they are copied through untouched.
+    int32 RunStart = 0;
+    for (int32 i = 0; i < Utf8.Num(); ++i)
+    {
+        const uint8 Byte = Utf8[i];
+        const ANSICHAR* Escape = Byte < 0x80 ? GetAsciiEscape(Byte) : nullptr;
+        if (!Escape && Byte >= 0x20)
+        {
+            continue;
+        }
+
+        Buffer.Append(Utf8.GetData() + RunStart, i - RunStart);
+        if (Escape)
+        {
+            AppendAnsi(Escape);
+        }
+        else
+        {
+            AppendControlEscape(Buffer, Byte);
+        }
+        RunStart = i + 1;
+    }
+    Buffer.Append(Utf8.GetData() + RunStart, Utf8.Num() - RunStart);
+}
@@ -0,0 +1,300 @@
+#include "MCPPropertyPlanCache.h"
+#include "MCPSearchPatterns.h"
+#include "MCPSession.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UnrealType.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+    TSharedPtr<FJsonValue> DeepCopy(const TSharedPtr<FJsonValue>& Value);
+
+    /** Objects and arrays are copied all the way down; leaf values are immutable and shared. */
+    TSharedRef<FJsonObject> DeepCopy(const FJsonObject& Object)
+    {
+        TSharedRef<FJsonObject> Copy = MakeShared<FJsonObject>();
+        Copy->Values.Reserve(Object.Values.Num());
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Object.Values)
+        {
+            Copy->Values.Add(Field.Key, DeepCopy(Field.Value));
+        }
+        return Copy;
+    }
+
+    TSharedPtr<FJsonValue> DeepCopy(const TSharedPtr<FJsonValue>& Value)
+    {
+        if (!Value.IsValid())
+        {
+            return Value;
+        }
+        if (Value->Type == EJson::Object && Value->AsObject().IsValid())
+        {
+            return MakeShared<FJsonValueObject>(DeepCopy(*Value->AsObject()));
+        }
+        if (Value->Type == EJson::Array)
+        {
+            TArray<TSharedPtr<FJsonValue>> Elements;
+            Elements.Reserve(Value->AsArray().Num());
+            for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+            {
+                Elements.Add(DeepCopy(Element));
+            }
+            return MakeShared<FJsonValueArray>(MoveTemp(Elements));
+        }
+        return Value;
+    }
+}
+
+static TAutoConsoleVariable<int32> CVarMcpPropertySnapshots(
+    TEXT("mcp.property_snapshots"), 1,
+    TEXT("Reuse inspect type=properties results for objects the editor hasn't reported as changed (1) or always re-read them (0)"),
+    ECVF_Default);
+
+FMCPPropertyPlan::FMCPPropertyPlan(const UClass* Class)
+    : PropertyLinkStamp(Class->PropertyLink)
+    , PropertiesSizeStamp(Class->GetPropertiesSize())
+{
+    for (TFieldIterator<FProperty> It(Class); It; ++It)
+    {
+        FMCPPropertyPlanEntry& Entry = Entries.AddDefaulted_GetRef();
+        Entry.Property = *It;
+        Entry.JsonKey = It->GetName();
+    }
+
+    // Entries is never resized after this, so the pointers below stay valid for the plan's lifetime.
+    AllEntries->Reserve(Entries.Num());
+    for (const FMCPPropertyPlanEntry& Entry : Entries)
+    {
+        AllEntries->Add(&Entry);
+    }
+}
+
+TSharedRef<const FMCPPropertyPlan::FEntryList> FMCPPropertyPlan::GetEntries(const FString& Filter)
+{
+    if (Filter.IsEmpty())
+    {
+        return AllEntries;
+    }
+
+    if (const TSharedRef<const FEntryList>* Found = FilteredEntries.Find(Filter))
+    {
+        return *Found;
+    }
+
+    const FMCPCompiledPattern Pattern = FMCPSearchPatterns::Compile(Filter);
+    TSharedRef<FEntryList> Matched = MakeShared<FEntryList>();
+    for (const FMCPPropertyPlanEntry* Entry : *AllEntries)
+    {
+        if (Pattern.Matches(Entry->JsonKey))
+        {
+            Matched->Add(Entry);
+        }
+    }
+    if (FilteredEntries.Num() < MaxCachedFilters)
+    {
+        FilteredEntries.Add(Filter, Matched);
+    }
+    return Matched;
+}
+
+bool FMCPPropertyPlan::IsValidFor(const UClass* Class) const
+{
+    return Class->PropertyLink == PropertyLinkStamp && Class->GetPropertiesSize() == PropertiesSizeStamp;
+}
+
+FMCPPropertyPlanCache& FMCPPropertyPlanCache::Get()
+{
+    static FMCPPropertyPlanCache Instance;
+    return Instance;
+}
+
+TSharedRef<FMCPPropertyPlan> FMCPPropertyPlanCache::GetPlan(const UClass* Class)
+{
+    check(IsInGameThread());
+    Subscribe();
+
+    if (Plans.Num() >= MaxPlans && !Plans.Contains(Class))
+    {
+        Plans.Reset();
+    }
+
+    TSharedPtr<FMCPPropertyPlan>& Plan = Plans.FindOrAdd(Class);
+    if (!Plan.IsValid() || !Plan->IsValidFor(Class))
+    {
+        Plan = MakeShared<FMCPPropertyPlan>(Class);
+    }
+    return Plan.ToSharedRef();
+}
+
+TSharedPtr<FJsonObject> FMCPPropertyPlanCache::FindSnapshot(const UObject* Obj, const FString& Filter, bool bSkipDefaults)
+{
+    check(IsInGameThread());
+
+    if (!CanSnapshot(Obj))
+    {
+        return nullptr;
+    }
+
+    const TArray<FSnapshot, TInlineAllocator<1>>* ObjectSnapshots = Snapshots.Find(Obj);
+    if (!ObjectSnapshots)
+    {
+        return nullptr;
+    }
+
+    const FMCPSessionStatePtr Session = FMCPSessionScope::GetCurrent();
+    const FGuid SessionId = Session.IsValid() ? Session->GetInfo().SessionId : FGuid();
+    for (const FSnapshot& Snapshot : *ObjectSnapshots)
+    {
+        if (Snapshot.bSkipDefaults == bSkipDefaults && Snapshot.SessionId == SessionId && Snapshot.Filter.Equals(Filter, ESearchCase::CaseSensitive))
+        {
+            // Callers are free to edit the result, nested struct objects included, so hand out a deep copy.
+            return DeepCopy(*Snapshot.Json);
+        }
+    }
+    return nullptr;
+}
+
+void FMCPPropertyPlanCache::AddSnapshot(const UObject* Obj, const FString& Filter, bool bSkipDefaults, const TSharedRef<FJsonObject>& Json)
+{
+    check(IsInGameThread());
+
+    if (!CanSnapshot(Obj))
+    {
+        return;
+    }
+
+    if (Snapshots.Num() >= MaxSnapshotObjects)
+    {
+        Snapshots.Reset();
+    }
+
+    const FMCPSessionStatePtr Session = FMCPSessionScope::GetCurrent();
+
+    TArray<FSnapshot, TInlineAllocator<1>>& ObjectSnapshots = Snapshots.FindOrAdd(Obj);
+    if (ObjectSnapshots.Num() >= MaxSnapshotsPerObject)
+    {
+        ObjectSnapshots.RemoveAt(0);
+    }
+
+    FSnapshot& Snapshot = ObjectSnapshots.AddDefaulted_GetRef();
+    Snapshot.Filter = Filter;
+    Snapshot.bSkipDefaults = bSkipDefaults;
+    Snapshot.SessionId = Session.IsValid() ? Session->GetInfo().SessionId : FGuid();
+    Snapshot.Json = DeepCopy(*Json);
+}
+
+void FMCPPropertyPlanCache::InvalidateObject(const UObject* Obj)
+{
+    if (!Obj || Snapshots.Num() == 0)
+    {
+        return;
+    }
+
+    // Objects that skip_defaults compares against: every snapshot of an instance may now differ.
+    if (Obj->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+    {
+        Snapshots.Reset();
+        return;
+    }
+    Snapshots.Remove(Obj);
+
+    // Editing an actor can change its components without an event for them, e.g. SetActorLocation
+    // moving the root component.
+    for (auto It = Snapshots.CreateIterator(); It; ++It)
+    {
+        const UObject* Snapshotted = It->Key.Get();
+        if (!Snapshotted || Snapshotted->IsIn(Obj))
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void FMCPPropertyPlanCache::Reset()
+{
+    Plans.Reset();
+    Snapshots.Reset();
+}
+
+int32 FMCPPropertyPlanCache::NumSnapshots() const
+{
+    int32 Count = 0;
+    for (const auto& Pair : Snapshots)
+    {
+        Count += Pair.Value.Num();
+    }
+    return Count;
+}
+
+bool FMCPPropertyPlanCache::CanSnapshot(const UObject* Obj) const
+{
+#if WITH_EDITOR
+    if (!Obj || CVarMcpPropertySnapshots.GetValueOnGameThread() == 0)
+    {
+        return false;
+    }
+    // PIE and game worlds change every tick without telling the editor.
+    const UWorld* World = Obj->GetWorld();
+    return !World || !World->IsGameWorld();
+#else
+    // Without editor change notifications a snapshot could never be invalidated.
+    return false;
+#endif
+}
+
+void FMCPPropertyPlanCache::Subscribe()
+{
+    if (bSubscribed)
+    {
+        return;
+    }
+
+    ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason)
+    {
+        Reset();
+    });
+#if WITH_EDITOR
+    ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddLambda([this](const TMap<UObject*, UObject*>&)
+    {
+        Reset();
+    });
+    PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FMCPPropertyPlanCache::HandleObjectPropertyChanged);
+    ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FMCPPropertyPlanCache::HandleObjectModified);
+    ObjectTransactedHandle = FCoreUObjectDelegates::OnObjectTransacted.AddRaw(this, &FMCPPropertyPlanCache::HandleObjectTransacted);
+#endif
+    bSubscribed = true;
+}
+
+void FMCPPropertyPlanCache::Shutdown()
+{
+    if (bSubscribed)
+    {
+        FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+#if WITH_EDITOR
+        FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+        FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+        FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+        FCoreUObjectDelegates::OnObjectTransacted.Remove(ObjectTransactedHandle);
+#endif
+        bSubscribed = false;
+    }
+    Reset();
+}
+
+#if WITH_EDITOR
+void FMCPPropertyPlanCache::HandleObjectPropertyChanged(UObject* Obj, FPropertyChangedEvent& Event)
+{
+    InvalidateObject(Obj);
+}
+
+void FMCPPropertyPlanCache::HandleObjectModified(UObject* Obj)
+{
+    InvalidateObject(Obj);
+}
+
+void FMCPPropertyPlanCache::HandleObjectTransacted(UObject* Obj, const FTransactionObjectEvent& Event)
+{
+    InvalidateObject(Obj);
+}
+#endif
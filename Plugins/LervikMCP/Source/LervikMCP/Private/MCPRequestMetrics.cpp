@@ -0,0 +1,36 @@
+#include "MCPRequestMetrics.h"
+
+void FMCPRequestMetrics::RecordParse(int32 BodyBytes, double ParseSeconds)
+{
+    const int64 Micros = FMath::Max<int64>(0, (int64)(ParseSeconds * 1000000.0));
+
+    ++RequestCount;
+    TotalBodyBytes += BodyBytes;
+    TotalParseMicros += Micros;
+
+    int64 CurrentMax = MaxParseMicros.Load();
+    while (Micros > CurrentMax && !MaxParseMicros.CompareExchange(CurrentMax, Micros))
+    {
+    }
+}
+
+int64 FMCPRequestMetrics::GetRequestCount() const
+{
+    return RequestCount.Load();
+}
+
+int64 FMCPRequestMetrics::GetBodyBytes() const
+{
+    return TotalBodyBytes.Load();
+}
+
+double FMCPRequestMetrics::GetAverageParseMs() const
+{
+    const int64 Count = RequestCount.Load();
+    return Count > 0 ? (double)TotalParseMicros.Load() / (double)Count / 1000.0 : 0.0;
+}
+
+double FMCPRequestMetrics::GetMaxParseMs() const
+{
+    return (double)MaxParseMicros.Load() / 1000.0;
+}
@@ -0,0 +1,193 @@
+#include "MCPResultPages.h"
+#include "MCPGameThreadHelper.h"
+#include "MCPJsonWriter.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Guid.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<float> CVarMcpCursorTtlSeconds(
+    TEXT("mcp.cursor_ttl_seconds"), 300.0f,
+    TEXT("Seconds a paginated find/inspect result stays available through its next_cursor"),
+    ECVF_Default);
+
+namespace
+{
+    /** Oldest snapshots are dropped beyond this, whatever their age. */
+    constexpr int32 MaxSnapshots = 32;
+
+    /** Cursors are "<snapshot id>.<offset>", so re-sending a cursor is idempotent. */
+    FString MakeCursor(const FString& Id, int32 Offset)
+    {
+        return FString::Printf(TEXT("%s.%d"), *Id, Offset);
+    }
+
+    bool ParseCursor(const FString& Cursor, FString& OutId, int32& OutOffset)
+    {
+        FString OffsetStr;
+        if (!Cursor.Split(TEXT("."), &OutId, &OffsetStr, ESearchCase::CaseSensitive, ESearchDir::FromEnd) || !OffsetStr.IsNumeric())
+        {
+            return false;
+        }
+        OutOffset = FCString::Atoi(*OffsetStr);
+        return OutOffset >= 0;
+    }
+
+    /** Direct calls outside any client request share the zero GUID. */
+    FGuid GetSessionId(const FMCPToolContext& Context)
+    {
+        FMCPSessionStatePtr Session = Context.GetSession();
+        if (!Session.IsValid())
+        {
+            Session = FMCPSessionScope::GetCurrent();
+        }
+        return Session.IsValid() ? Session->GetInfo().SessionId : FGuid();
+    }
+}
+
+FMCPResultPages& FMCPResultPages::Get()
+{
+    static FMCPResultPages Instance;
+    return Instance;
+}
+
+FMCPToolResult FMCPResultPages::MakeFirstPage(const FMCPToolContext& Context, const FString& Tool, FMCPResultList&& List, int32 PageSize)
+{
+    TSharedRef<FSnapshot> Snapshot = MakeShared<FSnapshot>();
+    Snapshot->List = MoveTemp(List);
+    Snapshot->PageSize = FMath::Max(1, PageSize);
+
+    FString Id;
+    if (Snapshot->List.Num > Snapshot->PageSize)
+    {
+        Snapshot->SessionId = GetSessionId(Context);
+        Snapshot->Tool = Tool;
+        const double Now = FPlatformTime::Seconds();
+        Snapshot->ExpireTime = Now + FMath::Max(0.0f, CVarMcpCursorTtlSeconds.GetValueOnAnyThread());
+        Id = FGuid::NewGuid().ToString(EGuidFormats::Base36Encoded);
+
+        FScopeLock ScopeLock(&Lock);
+        PruneExpired(Now);
+        Snapshots.Add(Id, Snapshot);
+    }
+
+    return MakePage(Id, *Snapshot, 0);
+}
+
+bool FMCPResultPages::TryServeCursor(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context, const FString& Tool,
+    TFuture<FMCPToolResult>& OutResult)
+{
+    FString Cursor;
+    if (!Params.IsValid() || !Params->TryGetStringField(TEXT("cursor"), Cursor) || Cursor.IsEmpty())
+    {
+        return false;
+    }
+
+    FString Id;
+    int32 Offset = 0;
+    TSharedPtr<const FSnapshot> Snapshot;
+    if (ParseCursor(Cursor, Id, Offset))
+    {
+        FScopeLock ScopeLock(&Lock);
+        PruneExpired(FPlatformTime::Seconds());
+        Snapshot = Snapshots.FindRef(Id);
+    }
+
+    // A cursor from another session or tool is reported like an unknown one, so cursors can't be probed.
+    if (!Snapshot.IsValid() || Offset >= Snapshot->List.Num
+        || Snapshot->SessionId != GetSessionId(Context) || Snapshot->Tool != Tool)
+    {
+        OutResult = MakeFulfilledPromise<FMCPToolResult>(
+            FMCPToolResult::Error(TEXT("Unknown or expired cursor. Re-run the query without 'cursor'"))).GetFuture();
+        return true;
+    }
+
+    if (Snapshot->List.bWriteOnGameThread)
+    {
+        OutResult = ExecuteOnGameThreadAsync(Context, [Id, Snapshot, Offset]() { return MakePage(Id, *Snapshot, Offset); });
+    }
+    else
+    {
+        OutResult = MakeFulfilledPromise<FMCPToolResult>(MakePage(Id, *Snapshot, Offset)).GetFuture();
+    }
+    return true;
+}
+
+int32 FMCPResultPages::GetSnapshotCount() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return Snapshots.Num();
+}
+
+FMCPToolResult FMCPResultPages::MakePage(const FString& Id, const FSnapshot& Snapshot, int32 Offset)
+{
+    const FMCPResultList& List = Snapshot.List;
+    const int32 End = FMath::Min(Offset + Snapshot.PageSize, List.Num);
+
+    // Pages are the largest tool replies, so they go straight to UTF-8 instead of through an FString.
+    FMCPJsonWriter Writer;
+    Writer.BeginObject();
+    if (List.Envelope.IsValid())
+    {
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : List.Envelope->Values)
+        {
+            Writer.WriteKey(Field.Key);
+            Writer.WriteValue(Field.Value);
+        }
+    }
+
+    int32 Count = 0;
+    Writer.WriteKey(List.ArrayField);
+    Writer.BeginArray();
+    for (int32 Index = Offset; Index < End; ++Index)
+    {
+        if (TSharedPtr<FJsonValue> Item = List.WriteItem(Index))
+        {
+            Writer.WriteValue(Item);
+            ++Count;
+        }
+    }
+    Writer.EndArray();
+
+    Writer.WriteKey("count");
+    Writer.WriteInteger(Count);
+    Writer.WriteKey("total");
+    Writer.WriteInteger(List.Num);
+    if (List.bTruncated)
+    {
+        Writer.WriteKey("truncated");
+        Writer.WriteBool(true);
+    }
+    if (End < List.Num)
+    {
+        Writer.WriteKey("next_cursor");
+        Writer.WriteString(MakeCursor(Id, End));
+    }
+    Writer.EndObject();
+    return FMCPToolResult::Utf8(Writer.Take());
+}
+
+void FMCPResultPages::PruneExpired(double Now)
+{
+    for (auto It = Snapshots.CreateIterator(); It; ++It)
+    {
+        if (It->Value->ExpireTime <= Now)
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    while (Snapshots.Num() >= MaxSnapshots)
+    {
+        const FString* OldestId = nullptr;
+        double OldestExpireTime = TNumericLimits<double>::Max();
+        for (const TPair<FString, TSharedPtr<const FSnapshot>>& Pair : Snapshots)
+        {
+            if (Pair.Value->ExpireTime < OldestExpireTime)
+            {
+                OldestId = &Pair.Key;
+                OldestExpireTime = Pair.Value->ExpireTime;
+            }
+        }
+        Snapshots.Remove(FString(*OldestId));
+    }
+}
@@ -1,42 +1,244 @@
 #include "MCPSearchPatterns.h"
 #include "Internationalization/Regex.h"
+#include "Containers/LruCache.h"
+#include "Misc/Crc.h"
+#include "Misc/ScopeLock.h"
 
-bool FMCPSearchPatterns::Matches(const FString& Pattern, const FString& Value)
+namespace
 {
-    if (Pattern.IsEmpty())
+    constexpr int32 PatternCacheCapacity = 64;
+
+    /** Raw regex patterns can differ only by case (\d vs \D), so cache keys compare case-sensitively. */
+    struct FPatternKeyComparer
     {
-        return true;
+        static bool Matches(const FString& A, const FString& B)
+        {
+            return A.Equals(B, ESearchCase::CaseSensitive);
+        }
+
+        static uint32 GetKeyHash(const FString& Key)
+        {
+            return FCrc::StrCrc32(*Key);
+        }
+    };
+
+    /** One glob alternative, lower-cased, with the leading/trailing '*' that unanchored matching implies removed. */
+    struct FGlob
+    {
+        FString Lower;
+        bool bHasWildcards = false;
+    };
+
+    /** Case-insensitive substring search. Needle is lower-case and non-empty. */
+    bool ContainsLiteral(FStringView Value, FStringView Needle)
+    {
+        const int32 LastStart = Value.Len() - Needle.Len();
+        if (LastStart < 0)
+        {
+            return false;
+        }
+
+        const TCHAR* Data = Value.GetData();
+        const TCHAR First = Needle[0];
+        const TCHAR FirstUpper = FChar::ToUpper(First);
+        for (int32 Start = 0; Start <= LastStart; ++Start)
+        {
+            // Cheap first-character filter before the full case-folding compare
+            if (Data[Start] != First && Data[Start] != FirstUpper)
+            {
+                continue;
+            }
+
+            int32 Offset = 1;
+            while (Offset < Needle.Len() && FChar::ToLower(Data[Start + Offset]) == Needle[Offset])
+            {
+                ++Offset;
+            }
+            if (Offset == Needle.Len())
+            {
+                return true;
+            }
+        }
+        return false;
     }
 
-    FString RegexStr;
+    /**
+     * Matches Glob anywhere in Value, i.e. "*Glob*" anchored. Greedy '*' with single-point backtracking,
+     * which is linear for the usual patterns and never worse than O(Value * Glob).
+     */
+    bool MatchGlobAnywhere(FStringView Value, FStringView Glob)
+    {
+        int32 ValueIndex = 0;
+        int32 GlobIndex = 0;
+        int32 StarGlobIndex = 0;
+        int32 StarValueIndex = 0;
+
+        while (ValueIndex < Value.Len())
+        {
+            if (GlobIndex == Glob.Len())
+            {
+                return true;
+            }
+
+            const TCHAR GlobChar = Glob[GlobIndex];
+            if (GlobChar == TEXT('*'))
+            {
+                StarGlobIndex = ++GlobIndex;
+                StarValueIndex = ValueIndex;
+            }
+            else if (GlobChar == TEXT('?') || FChar::ToLower(Value[ValueIndex]) == GlobChar)
+            {
+                ++ValueIndex;
+                ++GlobIndex;
+            }
+            else
+            {
+                // Retry from the last '*' (or the implicit leading one), consuming one more value char.
+                GlobIndex = StarGlobIndex;
+                ValueIndex = ++StarValueIndex;
+            }
+        }
+
+        while (GlobIndex < Glob.Len() && Glob[GlobIndex] == TEXT('*'))
+        {
+            ++GlobIndex;
+        }
+        return GlobIndex == Glob.Len();
+    }
+}
 
+struct FMCPCompiledPattern::FImpl
+{
+    /** Set for /regex/ patterns only. */
+    TOptional<FRegexPattern> Regex;
+    TArray<FGlob> Globs;
+    bool bMatchAll = false;
+};
+
+FMCPCompiledPattern::FMCPCompiledPattern(const FString& InPattern)
+    : Pattern(InPattern)
+{
+    if (Pattern.IsEmpty())
+    {
+        return;
+    }
+
+    TSharedRef<FImpl, ESPMode::ThreadSafe> NewImpl = MakeShared<FImpl, ESPMode::ThreadSafe>();
     if (Pattern.StartsWith(TEXT("/")))
     {
         // Raw regex mode: strip leading '/' and optional trailing '/'
-        RegexStr = Pattern.Mid(1);
+        FString RegexStr = Pattern.Mid(1);
         if (RegexStr.EndsWith(TEXT("/")))
         {
             RegexStr = RegexStr.LeftChop(1);
         }
+        NewImpl->Regex.Emplace(RegexStr, ERegexPatternFlags::CaseInsensitive);
     }
     else
     {
-        // Comma OR: split, convert each segment via wildcard-to-regex, join with '|'
+        // Comma OR; '|' has always acted as OR too since globs used to be joined into one regex
+        const TCHAR* Delimiters[] = { TEXT(","), TEXT("|") };
         TArray<FString> Segments;
-        Pattern.ParseIntoArray(Segments, TEXT(","), true);
+        Pattern.ParseIntoArray(Segments, Delimiters, UE_ARRAY_COUNT(Delimiters), true);
+
+        for (const FString& Segment : Segments)
+        {
+            FStringView Trimmed = FStringView(Segment).TrimStartAndEnd();
+            while (Trimmed.StartsWith(TEXT('*')))
+            {
+                Trimmed.RightChopInline(1);
+            }
+            while (Trimmed.EndsWith(TEXT('*')))
+            {
+                Trimmed.LeftChopInline(1);
+            }
 
-        TArray<FString> RegexSegments;
-        for (FString Segment : Segments)
+            if (Trimmed.IsEmpty())
+            {
+                NewImpl->bMatchAll = true;
+                break;
+            }
+
+            FGlob& Glob = NewImpl->Globs.AddDefaulted_GetRef();
+            Glob.Lower = FString(Trimmed).ToLower();
+            int32 WildcardIndex = INDEX_NONE;
+            Glob.bHasWildcards = Trimmed.FindChar(TEXT('*'), WildcardIndex) || Trimmed.FindChar(TEXT('?'), WildcardIndex);
+        }
+
+        // Nothing but separators, e.g. ","
+        NewImpl->bMatchAll |= NewImpl->Globs.Num() == 0;
+    }
+    Impl = NewImpl;
+}
+
+bool FMCPCompiledPattern::Matches(const FString& Value) const
+{
+    if (!Impl.IsValid() || Impl->bMatchAll)
+    {
+        return true;
+    }
+
+    if (Impl->Regex.IsSet())
+    {
+        FRegexMatcher Matcher(Impl->Regex.GetValue(), Value);
+        return Matcher.FindNext();
+    }
+
+    for (const FGlob& Glob : Impl->Globs)
+    {
+        if (Glob.bHasWildcards ? MatchGlobAnywhere(Value, Glob.Lower) : ContainsLiteral(Value, Glob.Lower))
         {
-            RegexSegments.Add(WildcardToRegex(Segment.TrimStartAndEnd()));
+            return true;
         }
+    }
+    return false;
+}
+
+bool FMCPCompiledPattern::GetRequiredLiterals(TArray<TArray<FString>>& OutAlternatives) const
+{
+    OutAlternatives.Reset();
+    if (!Impl.IsValid() || Impl->bMatchAll || Impl->Regex.IsSet())
+    {
+        return false;
+    }
+
+    const TCHAR* Wildcards[] = { TEXT("*"), TEXT("?") };
+    for (const FGlob& Glob : Impl->Globs)
+    {
+        TArray<FString>& Runs = OutAlternatives.AddDefaulted_GetRef();
+        Glob.Lower.ParseIntoArray(Runs, Wildcards, UE_ARRAY_COUNT(Wildcards), true);
+    }
+    return true;
+}
 
-        RegexStr = FString::Join(RegexSegments, TEXT("|"));
+FMCPCompiledPattern FMCPSearchPatterns::Compile(const FString& Pattern)
+{
+    if (Pattern.IsEmpty())
+    {
+        return FMCPCompiledPattern();
     }
 
-    FRegexPattern CompiledPattern(RegexStr, ERegexPatternFlags::CaseInsensitive);
-    FRegexMatcher Matcher(CompiledPattern, Value);
-    return Matcher.FindNext();
+    static FCriticalSection CacheLock;
+    static TLruCache<FString, FMCPCompiledPattern, FPatternKeyComparer> Cache(PatternCacheCapacity);
+
+    {
+        FScopeLock Lock(&CacheLock);
+        if (const FMCPCompiledPattern* Cached = Cache.FindAndTouch(Pattern))
+        {
+            return *Cached;
+        }
+    }
+
+    // Compile outside the lock; a concurrent miss on the same pattern just compiles it twice.
+    FMCPCompiledPattern Compiled(Pattern);
+    FScopeLock Lock(&CacheLock);
+    Cache.Add(Pattern, Compiled);
+    return Compiled;
+}
+
+bool FMCPSearchPatterns::Matches(const FString& Pattern, const FString& Value)
+{
+    return Compile(Pattern).Matches(Value);
 }
 
 FString FMCPSearchPatterns::WildcardToRegex(const FString& Wildcard)
@@ -80,10 +282,11 @@ FString FMCPSearchPatterns::WildcardToRegex(const FString& Wildcard)
 
 TArray<FString> FMCPSearchPatterns::FilterStrings(const TArray<FString>& Values, const FString& Pattern)
 {
+    const FMCPCompiledPattern Compiled = Compile(Pattern);
     TArray<FString> Result;
     for (const FString& Value : Values)
     {
-        if (Matches(Pattern, Value))
+        if (Compiled.Matches(Value))
         {
             Result.Add(Value);
         }
@@ -1,7 +1,8 @@
 #include "MCPServer.h"
 #include "MCPTypes.h"
+#include "MCPJsonWriter.h"
+#include "MCPGameThreadQueue.h"
 #include "IMCPTool.h"
-#include "Features/IModularFeatures.h"
 #include "HttpServerModule.h"
 #include "IHttpRouter.h"
 #include "HttpPath.h"
@@ -10,8 +11,277 @@
 #include "HttpServerConstants.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
-#include "Async/Async.h"
 #include "Async/TaskGraphInterfaces.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarMcpWorkers(
+    TEXT("mcp.workers"), 4,
+    TEXT("Number of MCP worker threads executing tools/call. Applied when the server (re)starts"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarMcpQueueDepth(
+    TEXT("mcp.queue_depth"), 64,
+    TEXT("Max tools/call requests waiting for an MCP worker. Requests beyond this are rejected as server busy"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarMcpSessionRateLimit(
+    TEXT("mcp.session_rate_limit"), 0.0f,
+    TEXT("tools/call requests per second allowed per MCP session. Calls beyond this are rejected as rate limited. 0 disables the limit"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarMcpSessionRateBurst(
+    TEXT("mcp.session_rate_burst"), 20,
+    TEXT("tools/call requests a session may send back to back before mcp.session_rate_limit applies"),
+    ECVF_Default);
+
+namespace
+{
+    TSharedPtr<FJsonObject> BuildToolsListResult(const TArray<FMCPToolInfo>& ToolInfos)
+    {
+        TArray<TSharedPtr<FJsonValue>> ToolsArray;
+        for (const FMCPToolInfo& Info : ToolInfos)
+        {
+            TSharedPtr<FJsonObject> Properties = MakeShared<FJsonObject>();
+            TArray<TSharedPtr<FJsonValue>> RequiredArray;
+            for (const FMCPToolParameter& Param : Info.Parameters)
+            {
+                auto MakeItemsSchema = [&Param]() {
+                    TSharedPtr<FJsonObject> Items = MakeShared<FJsonObject>();
+                    if (!Param.ItemsType.IsEmpty())
+                    {
+                        Items->SetStringField(TEXT("type"), Param.ItemsType);
+                    }
+                    return Items;
+                };
+
+                TSharedPtr<FJsonObject> ParamSchema = MakeShared<FJsonObject>();
+                if (Param.Type.Contains(TEXT("|")))
+                {
+                    TArray<FString> Parts;
+                    Param.Type.ParseIntoArray(Parts, TEXT("|"));
+                    TArray<TSharedPtr<FJsonValue>> OneOf;
+                    for (const FString& Part : Parts)
+                    {
+                        TSharedPtr<FJsonObject> Sub = MakeShared<FJsonObject>();
+                        Sub->SetStringField(TEXT("type"), Part);
+                        if (Part == TEXT("array"))
+                        {
+                            Sub->SetObjectField(TEXT("items"), MakeItemsSchema());
+                        }
+                        OneOf.Add(MakeShared<FJsonValueObject>(Sub));
+                    }
+                    ParamSchema->SetArrayField(TEXT("oneOf"), OneOf);
+                }
+                else if (Param.Type == TEXT("array"))
+                {
+                    ParamSchema->SetStringField(TEXT("type"), TEXT("array"));
+                    ParamSchema->SetObjectField(TEXT("items"), MakeItemsSchema());
+                }
+                else
+                {
+                    ParamSchema->SetStringField(TEXT("type"), Param.Type);
+                }
+                if (!Param.Description.IsEmpty())
+                {
+                    ParamSchema->SetStringField(TEXT("description"), Param.Description);
+                }
+                Properties->SetObjectField(Param.Name.ToString(), ParamSchema);
+                if (Param.bRequired)
+                {
+                    RequiredArray.Add(MakeShared<FJsonValueString>(Param.Name.ToString()));
+                }
+            }
+
+            TSharedPtr<FJsonObject> Schema = MakeShared<FJsonObject>();
+            Schema->SetStringField(TEXT("type"), TEXT("object"));
+            Schema->SetObjectField(TEXT("properties"), Properties);
+            if (RequiredArray.Num() > 0)
+            {
+                Schema->SetArrayField(TEXT("required"), RequiredArray);
+            }
+
+            TSharedPtr<FJsonObject> ToolObj = MakeShared<FJsonObject>();
+            ToolObj->SetStringField(TEXT("name"), Info.Name.ToString());
+            ToolObj->SetStringField(TEXT("description"), Info.Description);
+            ToolObj->SetObjectField(TEXT("inputSchema"), Schema);
+            ToolsArray.Add(MakeShared<FJsonValueObject>(ToolObj));
+        }
+
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetArrayField(TEXT("tools"), ToolsArray);
+        return Result;
+    }
+
+    /** Runs Work now when already on the game thread, otherwise queues it there. */
+    void RunOnGameThread(TUniqueFunction<void()>&& Work)
+    {
+        if (IsInGameThread())
+        {
+            Work();
+        }
+        else
+        {
+            FMCPGameThreadQueue::Get().Enqueue(MoveTemp(Work));
+        }
+    }
+
+    /**
+     * text/event-stream body for one tools/call. This is not a live stream: HTTPServer has no chunked or
+     * streaming write, so progress events are batched and sent ahead of the result when the call completes.
+     */
+    struct FMCPEventStream
+    {
+        FCriticalSection Lock;
+        TArray<uint8> Body;
+
+        void AppendEvent(const FString& Message)
+        {
+            FTCHARToUTF8 Utf8(*Message, Message.Len());
+            AppendEvent(TConstArrayView<uint8>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length()));
+        }
+
+        void AppendEvent(TConstArrayView<uint8> Utf8)
+        {
+            static const ANSICHAR EventPrefix[] = "event: message\ndata: ";
+            static const ANSICHAR DataPrefix[] = "data: ";
+
+            FScopeLock ScopeLock(&Lock);
+            Body.Reserve(Body.Num() + Utf8.Num() + UE_ARRAY_COUNT(EventPrefix) + 2);
+            Body.Append(reinterpret_cast<const uint8*>(EventPrefix), UE_ARRAY_COUNT(EventPrefix) - 1);
+            for (const uint8 Byte : Utf8)
+            {
+                // Each line of a multi-line payload needs its own data: field.
+                Body.Add(Byte);
+                if (Byte == '\n')
+                {
+                    Body.Append(reinterpret_cast<const uint8*>(DataPrefix), UE_ARRAY_COUNT(DataPrefix) - 1);
+                }
+            }
+            Body.Add('\n');
+            Body.Add('\n');
+        }
+
+        TArray<uint8> TakeBody()
+        {
+            FScopeLock ScopeLock(&Lock);
+            return MoveTemp(Body);
+        }
+    };
+
+    bool AcceptsEventStream(const FHttpServerRequest& Request)
+    {
+        if (const TArray<FString>* AcceptValues = Request.Headers.Find(TEXT("Accept")))
+        {
+            for (const FString& Value : *AcceptValues)
+            {
+                if (Value.Contains(TEXT("text/event-stream")))
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    TSharedPtr<FJsonValue> GetProgressToken(const TSharedPtr<FJsonObject>& Params)
+    {
+        const TSharedPtr<FJsonObject>* Meta = nullptr;
+        if (Params.IsValid() && Params->TryGetObjectField(TEXT("_meta"), Meta))
+        {
+            return (*Meta)->TryGetField(TEXT("progressToken"));
+        }
+        return nullptr;
+    }
+
+    FString MakeProgressNotification(const TSharedPtr<FJsonValue>& ProgressToken, double Progress, double Total, const FString& Message)
+    {
+        TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+        Params->SetField(TEXT("progressToken"), ProgressToken);
+        Params->SetNumberField(TEXT("progress"), Progress);
+        if (Total > 0.0)
+        {
+            Params->SetNumberField(TEXT("total"), Total);
+        }
+        if (!Message.IsEmpty())
+        {
+            Params->SetStringField(TEXT("message"), Message);
+        }
+        return FMCPResponse::Notification(TEXT("notifications/progress"), Params);
+    }
+
+    /**
+     * Map key for a JSON-RPC id within a session; clients number their requests independently.
+     * Empty for ids that can't be tracked (null or missing).
+     */
+    FString GetRequestKey(const FMCPSessionStatePtr& Session, const TSharedPtr<FJsonValue>& Id)
+    {
+        if (!Id.IsValid())
+        {
+            return FString();
+        }
+
+        const FString SessionPrefix = Session.IsValid() ? Session->GetInfo().SessionId.ToString(EGuidFormats::Digits) : FString();
+        if (Id->Type == EJson::Number)
+        {
+            return SessionPrefix + TEXT("/n:") + LexToString(Id->AsNumber());
+        }
+        if (Id->Type == EJson::String)
+        {
+            return SessionPrefix + TEXT("/s:") + Id->AsString();
+        }
+        return FString();
+    }
+
+    FString GetSessionHeaderValue(const FMCPSessionStatePtr& Session)
+    {
+        return Session.IsValid() ? Session->GetInfo().SessionId.ToString(EGuidFormats::DigitsWithHyphens) : FString();
+    }
+
+    TUniquePtr<FHttpServerResponse> MakeSessionNotFoundResponse(const TSharedPtr<FJsonValue>& Id)
+    {
+        // Streamable HTTP: an unknown or expired session is a 404, which tells the client to initialize again.
+        FString ErrorBody = FMCPResponse::Error(Id, MCPErrorCodes::InvalidRequest, TEXT("Session not found. Send initialize to start a new session"));
+        auto Response = FHttpServerResponse::Create(ErrorBody, TEXT("application/json"));
+        Response->Code = EHttpServerResponseCodes::NotFound;
+        return Response;
+    }
+
+    /** Takes a tools/call token from Session. On refusal, OutError holds the error response body. */
+    bool TryConsumeCall(const FMCPSessionStatePtr& Session, const TSharedPtr<FJsonValue>& Id, FString& OutError)
+    {
+        const float RateLimit = CVarMcpSessionRateLimit.GetValueOnAnyThread();
+        if (!Session.IsValid() || Session->TryConsumeCall(RateLimit, CVarMcpSessionRateBurst.GetValueOnAnyThread()))
+        {
+            return true;
+        }
+        OutError = FMCPResponse::Error(Id, MCPErrorCodes::RateLimited,
+            FString::Printf(TEXT("Rate limited: this session may make %g tools/call requests per second"), RateLimit));
+        return false;
+    }
+
+    TArray<uint8> ToUtf8(const FString& Str)
+    {
+        FTCHARToUTF8 Utf8(*Str, Str.Len());
+        return TArray<uint8>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+    }
+
+    /** A tools/call entry of a batch waiting to be executed. */
+    struct FMCPBatchCall
+    {
+        int32 Index = 0;
+        IMCPTool* Tool = nullptr;
+        TSharedPtr<FJsonObject> Arguments;
+        TSharedPtr<FJsonValue> Id;
+        FMCPToolContext Context;
+    };
+
+    /** Shared state of one JSON-RPC batch. Each entry writes only its own slot. */
+    struct FMCPBatchState
+    {
+        TArray<TArray<uint8>> Responses;
+        FThreadSafeCounter RemainingTasks;
+    };
+}
 
 FMCPServer::~FMCPServer()
 {
@@ -78,6 +348,25 @@ bool FMCPServer::Start(uint32 Port, FString& OutError)
         return false;
     }
 
+    DeleteMcpRouteHandle = HttpRouter->BindRoute(
+        FHttpPath(TEXT("/mcp")),
+        EHttpServerRequestVerbs::VERB_DELETE,
+        FHttpRequestHandler::CreateRaw(this, &FMCPServer::HandleDeleteSession)
+    );
+
+    if (!DeleteMcpRouteHandle.IsValid())
+    {
+        OutError = FString::Printf(TEXT("Failed to bind DELETE route /mcp on port %u"), Port);
+        HttpRouter->UnbindRoute(GetMcpRouteHandle);
+        GetMcpRouteHandle.Reset();
+        HttpRouter->UnbindRoute(SseRouteHandle);
+        SseRouteHandle.Reset();
+        HttpRouter->UnbindRoute(RouteHandle);
+        RouteHandle.Reset();
+        HttpRouter.Reset();
+        return false;
+    }
+
     PreprocessorHandle = HttpRouter->RegisterRequestPreprocessor(
         FHttpRequestHandler::CreateLambda([this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) -> bool
         {
@@ -92,12 +381,23 @@ bool FMCPServer::Start(uint32 Port, FString& OutError)
     InFlightTaskCount.Reset();
     bShuttingDown.Store(false);
 
+    ToolRegistry.Initialize();
+
+    if (!WorkerPool.Start(CVarMcpWorkers.GetValueOnAnyThread(), CVarMcpQueueDepth.GetValueOnAnyThread()))
+    {
+        OutError = TEXT("Failed to create MCP worker pool");
+        Stop();
+        return false;
+    }
+
     FHttpServerModule::Get().StartAllListeners();
     ServerPort = Port;
     bIsRunning = true;
 
-    // Auto-create a static session so clients don't need to call initialize
-    SessionManager.CreateSession(TEXT(""), TEXT(""), TEXT("2024-11-05"));
+    // Auto-create a static session so clients don't need to call initialize.
+    // Requests without an Mcp-Session-Id header use it; it is never evicted.
+    const FMCPSession Default = SessionManager.CreateSession(TEXT(""), TEXT(""), TEXT("2024-11-05"), true);
+    DefaultSession = SessionManager.FindSession(Default.SessionId);
 
     return true;
 }
@@ -117,9 +417,17 @@ void FMCPServer::Stop()
             break;
         }
         FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FMCPGameThreadQueue::Get().PumpAll();
         FPlatformProcess::Sleep(0.01f);
     }
 
+    WorkerPool.Stop();
+    ToolRegistry.Shutdown();
+    {
+        FScopeLock Lock(&ToolsListLock);
+        ToolsListCache.Reset();
+    }
+
     if (HttpRouter.IsValid())
     {
         if (RouteHandle.IsValid())
@@ -137,6 +445,11 @@ void FMCPServer::Stop()
             HttpRouter->UnbindRoute(GetMcpRouteHandle);
             GetMcpRouteHandle.Reset();
         }
+        if (DeleteMcpRouteHandle.IsValid())
+        {
+            HttpRouter->UnbindRoute(DeleteMcpRouteHandle);
+            DeleteMcpRouteHandle.Reset();
+        }
         if (PreprocessorHandle.IsValid())
         {
             HttpRouter->UnregisterRequestPreprocessor(PreprocessorHandle);
@@ -145,6 +458,8 @@ void FMCPServer::Stop()
     }
 
     HttpRouter.Reset();
+    DefaultSession.Reset();
+    SessionManager.DestroyAllSessions();
     ServerPort = 0;
     bIsRunning = false;
     bShuttingDown.Store(false);
@@ -165,14 +480,128 @@ FMCPSessionManager& FMCPServer::GetSessionManager()
     return SessionManager;
 }
 
-TOptional<FMCPSession> FMCPServer::GetSessionSnapshot() const
+TSharedRef<const FMCPToolsListCache> FMCPServer::GetToolsListCache()
+{
+    const uint32 Generation = ToolRegistry.GetGeneration();
+
+    FScopeLock Lock(&ToolsListLock);
+    if (ToolsListCache.IsValid() && ToolsListCache->Generation == Generation)
+    {
+        return ToolsListCache.ToSharedRef();
+    }
+
+    TSharedRef<FMCPToolsListCache> NewCache = MakeShared<FMCPToolsListCache>();
+    NewCache->Generation = Generation;
+
+    FMCPJsonWriter Writer;
+    Writer.WriteObject(BuildToolsListResult(ToolRegistry.GetToolInfos()));
+    NewCache->ResultUtf8 = Writer.Take();
+    NewCache->ETag = FString::Printf(TEXT("\"%08x-%u\""), FCrc::MemCrc32(NewCache->ResultUtf8.GetData(), NewCache->ResultUtf8.Num()), Generation);
+
+    ToolsListCache = NewCache;
+    return NewCache;
+}
+
+void FMCPServer::TrackCall(const TSharedPtr<FJsonValue>& Id, const FMCPToolContext& Context)
 {
-    FScopeLock Lock(&SessionLock);
-    if (const FMCPSession* S = SessionManager.GetSession())
+    const FString Key = GetRequestKey(Context.GetSession(), Id);
+    if (!Key.IsEmpty())
     {
-        return *S;
+        FScopeLock Lock(&InFlightCallsLock);
+        InFlightCalls.Add(Key, Context);
     }
-    return {};
+}
+
+void FMCPServer::UntrackCall(const TSharedPtr<FJsonValue>& Id, const FMCPToolContext& Context)
+{
+    const FString Key = GetRequestKey(Context.GetSession(), Id);
+    if (!Key.IsEmpty())
+    {
+        FScopeLock Lock(&InFlightCallsLock);
+        // A client may reuse an id once its response is sent; only drop our own entry.
+        const FMCPToolContext* Tracked = InFlightCalls.Find(Key);
+        if (Tracked && *Tracked == Context)
+        {
+            InFlightCalls.Remove(Key);
+        }
+    }
+}
+
+void FMCPServer::HandleCancelledNotification(const FMCPRequest& Notification, const FMCPSessionStatePtr& Session)
+{
+    if (!Notification.Params.IsValid())
+    {
+        return;
+    }
+
+    const FString Key = GetRequestKey(Session, Notification.Params->TryGetField(TEXT("requestId")));
+    if (Key.IsEmpty())
+    {
+        return;
+    }
+
+    FScopeLock Lock(&InFlightCallsLock);
+    if (const FMCPToolContext* Tracked = InFlightCalls.Find(Key))
+    {
+        Tracked->Cancel();
+    }
+}
+
+const FMCPWorkerPool& FMCPServer::GetWorkerPool() const
+{
+    return WorkerPool;
+}
+
+const FMCPRequestMetrics& FMCPServer::GetRequestMetrics() const
+{
+    return RequestMetrics;
+}
+
+TArray<FMCPSession> FMCPServer::GetSessionSnapshots() const
+{
+    return SessionManager.GetSessions();
+}
+
+FMCPSessionStatePtr FMCPServer::ResolveSession(const FHttpServerRequest& Request)
+{
+    const TArray<FString>* HeaderValues = Request.Headers.Find(TEXT("Mcp-Session-Id"));
+    if (!HeaderValues || HeaderValues->Num() == 0 || (*HeaderValues)[0].IsEmpty())
+    {
+        if (DefaultSession.IsValid())
+        {
+            DefaultSession->Touch();
+        }
+        return DefaultSession;
+    }
+
+    FGuid SessionId;
+    if (!FGuid::Parse((*HeaderValues)[0], SessionId))
+    {
+        return nullptr;
+    }
+    return SessionManager.FindSession(SessionId);
+}
+
+bool FMCPServer::HandleDeleteSession(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+    auto Response = FHttpServerResponse::Create(TEXT(""), TEXT("text/plain"));
+    const FMCPSessionStatePtr Session = Request.Headers.Contains(TEXT("Mcp-Session-Id")) ? ResolveSession(Request) : FMCPSessionStatePtr();
+    if (!Session.IsValid())
+    {
+        Response->Code = EHttpServerResponseCodes::NotFound;
+    }
+    else if (Session->IsPinned())
+    {
+        // The static session is shared by every client that never sent initialize.
+        Response->Code = EHttpServerResponseCodes::BadMethod;
+    }
+    else
+    {
+        SessionManager.DestroySession(Session->GetInfo().SessionId);
+        Response->Code = EHttpServerResponseCodes::Ok;
+    }
+    OnComplete(MoveTemp(Response));
+    return true;
 }
 
 bool FMCPServer::HandleMethodNotAllowed(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
@@ -187,19 +616,17 @@ bool FMCPServer::HandleMethodNotAllowed(const FHttpServerRequest& Request, const
 
 bool FMCPServer::HandleMcpRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
-    // Decode body from UTF-8
-    FString BodyString;
-    if (Request.Body.Num() > 0)
-    {
-        TArray<uint8> NullTerminated = Request.Body;
-        NullTerminated.Add(0);
-        BodyString = FString(UTF8_TO_TCHAR(reinterpret_cast<const ANSICHAR*>(NullTerminated.GetData())));
-    }
-
-    // Parse JSON-RPC request
-    FMCPRequest McpRequest;
+    // Parse JSON-RPC request (single object or batch array) straight from the UTF-8 body
+    TArray<FMCPRequest> ParsedRequests;
+    bool bIsBatch = false;
     FString ParseError;
-    if (!FMCPRequest::Parse(BodyString, McpRequest, ParseError))
+    const double ParseStart = FPlatformTime::Seconds();
+    const bool bParsed = FMCPRequest::ParseMessage(
+        FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Request.Body.GetData()), Request.Body.Num()),
+        ParsedRequests, bIsBatch, ParseError);
+    RequestMetrics.RecordParse(Request.Body.Num(), FPlatformTime::Seconds() - ParseStart);
+
+    if (!bParsed)
     {
         FString ErrorBody = FMCPResponse::Error(nullptr, MCPErrorCodes::ParseError, ParseError);
         auto Response = FHttpServerResponse::Create(ErrorBody, TEXT("application/json"));
@@ -208,37 +635,41 @@ bool FMCPServer::HandleMcpRequest(const FHttpServerRequest& Request, const FHttp
         return true;
     }
 
-    // JSON-RPC 2.0: server MUST NOT reply to notifications
-    // MCP Streamable HTTP spec requires 202 Accepted for notifications
-    if (McpRequest.bIsNotification)
+    if (bIsBatch)
     {
-        auto Response = FHttpServerResponse::Create(TEXT(""), TEXT("text/plain"));
-        Response->Code = EHttpServerResponseCodes::Accepted;
-        OnComplete(MoveTemp(Response));
-        return true;
+        return HandleBatchRequest(Request, MoveTemp(ParsedRequests), OnComplete);
     }
 
-    // Session guard: all methods except "initialize" require an active session
+    const FMCPRequest& McpRequest = ParsedRequests[0];
+
+    // Session guard: all methods except "initialize" run in the session named by Mcp-Session-Id
+    FMCPSessionStatePtr Session;
     if (McpRequest.Method != TEXT("initialize"))
     {
-        FScopeLock Lock(&SessionLock);
-        if (!SessionManager.HasSession())
+        Session = ResolveSession(Request);
+        if (!Session.IsValid())
         {
-            FString ErrorBody = FMCPResponse::Error(McpRequest.Id, MCPErrorCodes::InvalidRequest, TEXT("No active session"));
-            auto Response = FHttpServerResponse::Create(ErrorBody, TEXT("application/json"));
-            Response->Code = EHttpServerResponseCodes::Ok;
-            OnComplete(MoveTemp(Response));
+            OnComplete(MakeSessionNotFoundResponse(McpRequest.Id));
             return true;
         }
     }
 
-    FString ActiveSessionId;
+    // JSON-RPC 2.0: server MUST NOT reply to notifications
+    // MCP Streamable HTTP spec requires 202 Accepted for notifications
+    if (McpRequest.bIsNotification)
     {
-        FScopeLock Lock(&SessionLock);
-        if (const FMCPSession* S = SessionManager.GetSession())
-            ActiveSessionId = S->SessionId.ToString(EGuidFormats::DigitsWithHyphens);
+        if (McpRequest.Method == TEXT("notifications/cancelled"))
+        {
+            HandleCancelledNotification(McpRequest, Session);
+        }
+        auto Response = FHttpServerResponse::Create(TEXT(""), TEXT("text/plain"));
+        Response->Code = EHttpServerResponseCodes::Accepted;
+        OnComplete(MoveTemp(Response));
+        return true;
     }
 
+    const FString ActiveSessionId = GetSessionHeaderValue(Session);
+
     auto CompleteWithSession = [&ActiveSessionId, &OnComplete](TUniquePtr<FHttpServerResponse> Resp)
     {
         if (!ActiveSessionId.IsEmpty())
@@ -267,11 +698,8 @@ bool FMCPServer::HandleMcpRequest(const FHttpServerRequest& Request, const FHttp
             ProtocolVersion = TEXT("2024-11-05");
         }
 
-        FMCPSession Session;
-        {
-            FScopeLock Lock(&SessionLock);
-            Session = SessionManager.CreateSession(ClientName, ClientVersion, ProtocolVersion);
-        }
+        // Every initialize starts a fresh session with its own compact IDs, even from a client that already has one.
+        const FMCPSession NewSession = SessionManager.CreateSession(ClientName, ClientVersion, ProtocolVersion);
 
         TSharedPtr<FJsonObject> Tools = MakeShared<FJsonObject>();
         TSharedPtr<FJsonObject> Capabilities = MakeShared<FJsonObject>();
@@ -289,98 +717,17 @@ bool FMCPServer::HandleMcpRequest(const FHttpServerRequest& Request, const FHttp
         FString ResponseBody = FMCPResponse::Success(McpRequest.Id, Result);
         auto Response = FHttpServerResponse::Create(ResponseBody, TEXT("application/json"));
         Response->Code = EHttpServerResponseCodes::Ok;
-        Response->Headers.Add(TEXT("Mcp-Session-Id"), { Session.SessionId.ToString(EGuidFormats::DigitsWithHyphens) });
+        Response->Headers.Add(TEXT("Mcp-Session-Id"), { NewSession.SessionId.ToString(EGuidFormats::DigitsWithHyphens) });
         OnComplete(MoveTemp(Response));
         return true;
     }
     else if (McpRequest.Method == TEXT("tools/list"))
     {
-        TArray<FMCPToolInfo> ToolInfos;
-        {
-            IModularFeatures::FScopedLockModularFeatureList ScopedLock;
-            TArray<IMCPTool*> RegisteredTools = IModularFeatures::Get().GetModularFeatureImplementations<IMCPTool>(
-                IMCPTool::GetModularFeatureName());
-            for (IMCPTool* Tool : RegisteredTools)
-            {
-                ToolInfos.Add(Tool->GetToolInfo());
-            }
-        }
-
-        TArray<TSharedPtr<FJsonValue>> ToolsArray;
-        for (const FMCPToolInfo& Info : ToolInfos)
-        {
-            TSharedPtr<FJsonObject> Properties = MakeShared<FJsonObject>();
-            TArray<TSharedPtr<FJsonValue>> RequiredArray;
-            for (const FMCPToolParameter& Param : Info.Parameters)
-            {
-                auto MakeItemsSchema = [&Param]() {
-                    TSharedPtr<FJsonObject> Items = MakeShared<FJsonObject>();
-                    if (!Param.ItemsType.IsEmpty())
-                    {
-                        Items->SetStringField(TEXT("type"), Param.ItemsType);
-                    }
-                    return Items;
-                };
-
-                TSharedPtr<FJsonObject> ParamSchema = MakeShared<FJsonObject>();
-                if (Param.Type.Contains(TEXT("|")))
-                {
-                    TArray<FString> Parts;
-                    Param.Type.ParseIntoArray(Parts, TEXT("|"));
-                    TArray<TSharedPtr<FJsonValue>> OneOf;
-                    for (const FString& Part : Parts)
-                    {
-                        TSharedPtr<FJsonObject> Sub = MakeShared<FJsonObject>();
-                        Sub->SetStringField(TEXT("type"), Part);
-                        if (Part == TEXT("array"))
-                        {
-                            Sub->SetObjectField(TEXT("items"), MakeItemsSchema());
-                        }
-                        OneOf.Add(MakeShared<FJsonValueObject>(Sub));
-                    }
-                    ParamSchema->SetArrayField(TEXT("oneOf"), OneOf);
-                }
-                else if (Param.Type == TEXT("array"))
-                {
-                    ParamSchema->SetStringField(TEXT("type"), TEXT("array"));
-                    ParamSchema->SetObjectField(TEXT("items"), MakeItemsSchema());
-                }
-                else
-                {
-                    ParamSchema->SetStringField(TEXT("type"), Param.Type);
-                }
-                if (!Param.Description.IsEmpty())
-                {
-                    ParamSchema->SetStringField(TEXT("description"), Param.Description);
-                }
-                Properties->SetObjectField(Param.Name.ToString(), ParamSchema);
-                if (Param.bRequired)
-                {
-                    RequiredArray.Add(MakeShared<FJsonValueString>(Param.Name.ToString()));
-                }
-            }
-
-            TSharedPtr<FJsonObject> Schema = MakeShared<FJsonObject>();
-            Schema->SetStringField(TEXT("type"), TEXT("object"));
-            Schema->SetObjectField(TEXT("properties"), Properties);
-            if (RequiredArray.Num() > 0)
-            {
-                Schema->SetArrayField(TEXT("required"), RequiredArray);
-            }
-
-            TSharedPtr<FJsonObject> ToolObj = MakeShared<FJsonObject>();
-            ToolObj->SetStringField(TEXT("name"), Info.Name.ToString());
-            ToolObj->SetStringField(TEXT("description"), Info.Description);
-            ToolObj->SetObjectField(TEXT("inputSchema"), Schema);
-            ToolsArray.Add(MakeShared<FJsonValueObject>(ToolObj));
-        }
-
-        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-        Result->SetArrayField(TEXT("tools"), ToolsArray);
-
-        FString ResponseBody = FMCPResponse::Success(McpRequest.Id, Result);
-        auto Response = FHttpServerResponse::Create(ResponseBody, TEXT("application/json"));
+        TSharedRef<const FMCPToolsListCache> ToolsList = GetToolsListCache();
+        TArray<uint8> ResponseBody = FMCPResponse::SuccessRaw(McpRequest.Id, ToolsList->ResultUtf8);
+        auto Response = FHttpServerResponse::Create(MoveTemp(ResponseBody), TEXT("application/json"));
         Response->Code = EHttpServerResponseCodes::Ok;
+        Response->Headers.Add(TEXT("ETag"), { ToolsList->ETag });
         CompleteWithSession(MoveTemp(Response));
         return true;
     }
@@ -396,20 +743,7 @@ bool FMCPServer::HandleMcpRequest(const FHttpServerRequest& Request, const FHttp
             return true;
         }
 
-        IMCPTool* FoundTool = nullptr;
-        {
-            IModularFeatures::FScopedLockModularFeatureList ScopedLock;
-            TArray<IMCPTool*> RegisteredTools = IModularFeatures::Get().GetModularFeatureImplementations<IMCPTool>(
-                IMCPTool::GetModularFeatureName());
-            for (IMCPTool* Tool : RegisteredTools)
-            {
-                if (Tool->GetToolInfo().Name.ToString() == ToolName)
-                {
-                    FoundTool = Tool;
-                    break;
-                }
-            }
-        }
+        IMCPTool* FoundTool = ToolRegistry.FindTool(ToolName);
 
         if (!FoundTool)
         {
@@ -421,6 +755,15 @@ bool FMCPServer::HandleMcpRequest(const FHttpServerRequest& Request, const FHttp
             return true;
         }
 
+        FString RateLimitError;
+        if (!TryConsumeCall(Session, McpRequest.Id, RateLimitError))
+        {
+            auto Response = FHttpServerResponse::Create(RateLimitError, TEXT("application/json"));
+            Response->Code = EHttpServerResponseCodes::Ok;
+            CompleteWithSession(MoveTemp(Response));
+            return true;
+        }
+
         TSharedPtr<FJsonObject> Arguments;
         if (McpRequest.Params.IsValid() && McpRequest.Params->HasField(TEXT("arguments")))
         {
@@ -439,40 +782,80 @@ bool FMCPServer::HandleMcpRequest(const FHttpServerRequest& Request, const FHttp
             return true;
         }
 
-        // Dispatch tool execution to background thread so long-running tools
+        // Dispatch tool execution to the worker pool so long-running tools
         // (e.g. trace test with Sleep) don't block the game thread.
         TSharedPtr<FJsonValue> RequestIdCopy = McpRequest.Id;
         FString SessionIdCopy = ActiveSessionId;
 
-        Async(EAsyncExecution::Thread, [this, FoundTool, Arguments, RequestIdCopy, SessionIdCopy, OnComplete]()
+        // Clients that asked for progress and accept an event stream get their progress events batched
+        // ahead of the result in one event-stream response, not while the tool runs.
+        TSharedPtr<FMCPEventStream> EventStream;
+        FMCPToolContext::FProgressHandler ProgressHandler;
+        TSharedPtr<FJsonValue> ProgressToken = GetProgressToken(McpRequest.Params);
+        if (ProgressToken.IsValid() && AcceptsEventStream(Request))
         {
-            FMCPToolResult ToolResult = FoundTool->Execute(Arguments);
-
-            TSharedPtr<FJsonObject> ContentItem = MakeShared<FJsonObject>();
-            ContentItem->SetStringField(TEXT("type"), TEXT("text"));
-            ContentItem->SetStringField(TEXT("text"), ToolResult.Content);
-
-            TArray<TSharedPtr<FJsonValue>> ContentArray;
-            ContentArray.Add(MakeShared<FJsonValueObject>(ContentItem));
-
-            TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-            Result->SetArrayField(TEXT("content"), ContentArray);
-            Result->SetBoolField(TEXT("isError"), ToolResult.bIsError);
-
-            FString ResponseBody = FMCPResponse::Success(RequestIdCopy, Result);
+            EventStream = MakeShared<FMCPEventStream>();
+            ProgressHandler = [EventStream, ProgressToken](double Progress, double Total, const FString& Message)
+            {
+                EventStream->AppendEvent(MakeProgressNotification(ProgressToken, Progress, Total, Message));
+            };
+        }
+        FMCPToolContext Context(MoveTemp(ProgressHandler), Session);
+        TrackCall(RequestIdCopy, Context);
 
-            AsyncTask(ENamedThreads::GameThread, [this, ResponseBody, SessionIdCopy, OnComplete]()
+        // Completes the HTTP request on the game thread, whether the tool ran or was dropped at shutdown.
+        auto Respond = [this, Context, EventStream, RequestIdCopy, SessionIdCopy, OnComplete](TArray<uint8>&& ResponseBody)
+        {
+            RunOnGameThread([this, ResponseBody = MoveTemp(ResponseBody), Context, EventStream, RequestIdCopy, SessionIdCopy, OnComplete]() mutable
             {
-                auto Response = FHttpServerResponse::Create(ResponseBody, TEXT("application/json"));
+                TUniquePtr<FHttpServerResponse> Response;
+                if (EventStream.IsValid())
+                {
+                    EventStream->AppendEvent(ResponseBody);
+                    Response = FHttpServerResponse::Create(EventStream->TakeBody(), TEXT("text/event-stream"));
+                    Response->Headers.Add(TEXT("Cache-Control"), { TEXT("no-cache") });
+                }
+                else
+                {
+                    Response = FHttpServerResponse::Create(MoveTemp(ResponseBody), TEXT("application/json"));
+                }
                 Response->Code = EHttpServerResponseCodes::Ok;
                 if (!SessionIdCopy.IsEmpty())
                 {
                     Response->Headers.Add(TEXT("Mcp-Session-Id"), { SessionIdCopy });
                 }
                 OnComplete(MoveTemp(Response));
+                UntrackCall(RequestIdCopy, Context);
                 InFlightTaskCount.Decrement();
             });
+        };
+
+        WorkerPool.SetMaxQueueDepth(CVarMcpQueueDepth.GetValueOnAnyThread());
+        const bool bQueued = WorkerPool.TryEnqueue([FoundTool, Arguments, Context, RequestIdCopy, Respond]()
+        {
+            // Game-thread tools only queue their work here; the worker is released straight away.
+            FMCPSessionScope SessionScope(Context.GetSession());
+            FoundTool->ExecuteAsync(Arguments, Context).Next([RequestIdCopy, Respond](FMCPToolResult ToolResult)
+            {
+                Respond(FMCPResponse::ToolCallSuccess(RequestIdCopy, ToolResult));
+            });
+        },
+        [RequestIdCopy, Respond]()
+        {
+            // Still queued when Stop() gave up draining; the client gets an answer instead of a dropped connection.
+            Respond(ToUtf8(FMCPResponse::Error(RequestIdCopy, MCPErrorCodes::InternalError, TEXT("Server is shutting down"))));
         });
+
+        if (!bQueued)
+        {
+            UntrackCall(RequestIdCopy, Context);
+            InFlightTaskCount.Decrement();
+            FString ErrorBody = FMCPResponse::Error(McpRequest.Id, MCPErrorCodes::ServerBusy,
+                FString::Printf(TEXT("Server busy: %d requests already queued"), WorkerPool.GetQueueDepth()));
+            auto Response = FHttpServerResponse::Create(ErrorBody, TEXT("application/json"));
+            Response->Code = EHttpServerResponseCodes::Ok;
+            CompleteWithSession(MoveTemp(Response));
+        }
         return true;
     }
     else if (McpRequest.Method == TEXT("ping"))
@@ -494,3 +877,227 @@ bool FMCPServer::HandleMcpRequest(const FHttpServerRequest& Request, const FHttp
         return true;
     }
 }
+
+bool FMCPServer::HandleBatchRequest(const FHttpServerRequest& Request, TArray<FMCPRequest>&& Requests, const FHttpResultCallback& OnComplete)
+{
+    if (Requests.Num() == 0)
+    {
+        FString ErrorBody = FMCPResponse::Error(nullptr, MCPErrorCodes::InvalidRequest, TEXT("Empty batch"));
+        auto Response = FHttpServerResponse::Create(ErrorBody, TEXT("application/json"));
+        Response->Code = EHttpServerResponseCodes::Ok;
+        OnComplete(MoveTemp(Response));
+        return true;
+    }
+
+    const FMCPSessionStatePtr Session = ResolveSession(Request);
+    if (!Session.IsValid())
+    {
+        OnComplete(MakeSessionNotFoundResponse(nullptr));
+        return true;
+    }
+    const FString ActiveSessionId = GetSessionHeaderValue(Session);
+
+    TSharedRef<FMCPBatchState> Batch = MakeShared<FMCPBatchState>();
+    Batch->Responses.SetNum(Requests.Num());
+
+    // Resolve every entry up front. Cheap methods are answered inline; tool calls are grouped by thread.
+    TArray<FMCPBatchCall> GameThreadCalls;
+    TArray<FMCPBatchCall> WorkerCalls;
+    for (int32 Index = 0; Index < Requests.Num(); ++Index)
+    {
+        const FMCPRequest& Entry = Requests[Index];
+        TArray<uint8>& Slot = Batch->Responses[Index];
+
+        if (!Entry.ParseError.IsEmpty())
+        {
+            Slot = ToUtf8(FMCPResponse::Error(Entry.Id, MCPErrorCodes::InvalidRequest, Entry.ParseError));
+            continue;
+        }
+        if (Entry.bIsNotification)
+        {
+            if (Entry.Method == TEXT("notifications/cancelled"))
+            {
+                HandleCancelledNotification(Entry, Session);
+            }
+            continue;
+        }
+
+        if (Entry.Method == TEXT("tools/call"))
+        {
+            FString ToolName;
+            if (!Entry.Params.IsValid() || !Entry.Params->TryGetStringField(TEXT("name"), ToolName))
+            {
+                Slot = ToUtf8(FMCPResponse::Error(Entry.Id, MCPErrorCodes::InvalidParams, TEXT("Missing tool name")));
+                continue;
+            }
+
+            bool bRunsOnGameThread = true;
+            IMCPTool* Tool = ToolRegistry.FindTool(ToolName, &bRunsOnGameThread);
+            if (!Tool)
+            {
+                Slot = ToUtf8(FMCPResponse::Error(Entry.Id, MCPErrorCodes::MethodNotFound,
+                    FString::Printf(TEXT("Tool not found: %s"), *ToolName)));
+                continue;
+            }
+
+            FString RateLimitError;
+            if (!TryConsumeCall(Session, Entry.Id, RateLimitError))
+            {
+                Slot = ToUtf8(RateLimitError);
+                continue;
+            }
+
+            FMCPBatchCall& Call = (bRunsOnGameThread ? GameThreadCalls : WorkerCalls).AddDefaulted_GetRef();
+            Call.Index = Index;
+            Call.Tool = Tool;
+            Call.Id = Entry.Id;
+            Call.Context = FMCPToolContext(FMCPToolContext::FProgressHandler(), Session);
+            if (Entry.Params->HasField(TEXT("arguments")))
+            {
+                Call.Arguments = Entry.Params->GetObjectField(TEXT("arguments"));
+            }
+        }
+        else if (Entry.Method == TEXT("tools/list"))
+        {
+            Slot = FMCPResponse::SuccessRaw(Entry.Id, GetToolsListCache()->ResultUtf8);
+        }
+        else if (Entry.Method == TEXT("ping"))
+        {
+            Slot = ToUtf8(FMCPResponse::Success(Entry.Id, MakeShared<FJsonObject>()));
+        }
+        else if (Entry.Method == TEXT("initialize"))
+        {
+            Slot = ToUtf8(FMCPResponse::Error(Entry.Id, MCPErrorCodes::InvalidRequest, TEXT("initialize must not be part of a batch")));
+        }
+        else
+        {
+            Slot = ToUtf8(FMCPResponse::Error(Entry.Id, MCPErrorCodes::MethodNotFound,
+                FString::Printf(TEXT("Method not found: %s"), *Entry.Method)));
+        }
+    }
+
+    // One in-flight slot covers the whole batch; it is released after the combined response is sent.
+    InFlightTaskCount.Increment();
+    if (bShuttingDown.Load() && (GameThreadCalls.Num() > 0 || WorkerCalls.Num() > 0))
+    {
+        GameThreadCalls.Append(MoveTemp(WorkerCalls));
+        for (const FMCPBatchCall& Call : GameThreadCalls)
+        {
+            Batch->Responses[Call.Index] = ToUtf8(FMCPResponse::Error(Call.Id, MCPErrorCodes::InternalError, TEXT("Server is shutting down")));
+        }
+        GameThreadCalls.Empty();
+        WorkerCalls.Empty();
+    }
+
+    for (const FMCPBatchCall& Call : GameThreadCalls)
+    {
+        TrackCall(Call.Id, Call.Context);
+    }
+    for (const FMCPBatchCall& Call : WorkerCalls)
+    {
+        TrackCall(Call.Id, Call.Context);
+    }
+
+    auto SendBatchResponse = [this, Batch, ActiveSessionId, OnComplete]()
+    {
+        TArray<uint8> Body;
+        for (const TArray<uint8>& Entry : Batch->Responses)
+        {
+            if (Entry.Num() == 0)
+            {
+                continue;
+            }
+            Body.Add(Body.Num() == 0 ? '[' : ',');
+            Body.Append(Entry);
+        }
+
+        RunOnGameThread([this, Body = MoveTemp(Body), ActiveSessionId, OnComplete]() mutable
+        {
+            TUniquePtr<FHttpServerResponse> Response;
+            if (Body.Num() == 0)
+            {
+                // Batch of notifications only
+                Response = FHttpServerResponse::Create(TEXT(""), TEXT("text/plain"));
+                Response->Code = EHttpServerResponseCodes::Accepted;
+            }
+            else
+            {
+                Body.Add(']');
+                Response = FHttpServerResponse::Create(MoveTemp(Body), TEXT("application/json"));
+                Response->Code = EHttpServerResponseCodes::Ok;
+            }
+            if (!ActiveSessionId.IsEmpty())
+            {
+                Response->Headers.Add(TEXT("Mcp-Session-Id"), { ActiveSessionId });
+            }
+            OnComplete(MoveTemp(Response));
+            InFlightTaskCount.Decrement();
+        });
+    };
+
+    const int32 NumTasks = WorkerCalls.Num() + GameThreadCalls.Num();
+    if (NumTasks == 0)
+    {
+        SendBatchResponse();
+        return true;
+    }
+
+    Batch->RemainingTasks.Set(NumTasks);
+    auto FinishTask = [Batch, SendBatchResponse]()
+    {
+        if (Batch->RemainingTasks.Decrement() == 0)
+        {
+            SendBatchResponse();
+        }
+    };
+
+    // Game-thread tools run back to back in a single queued game-thread item instead of one item per call.
+    if (GameThreadCalls.Num() > 0)
+    {
+        FMCPGameThreadQueue::Get().Enqueue([this, Batch, Session, Calls = MoveTemp(GameThreadCalls), FinishTask]()
+        {
+            FMCPSessionScope SessionScope(Session);
+            for (const FMCPBatchCall& Call : Calls)
+            {
+                Call.Tool->ExecuteAsync(Call.Arguments, Call.Context).Next([this, Batch, Call, FinishTask](FMCPToolResult ToolResult)
+                {
+                    Batch->Responses[Call.Index] = FMCPResponse::ToolCallSuccess(Call.Id, ToolResult);
+                    UntrackCall(Call.Id, Call.Context);
+                    FinishTask();
+                });
+            }
+        });
+    }
+
+    // Everything else fans out across the worker pool.
+    WorkerPool.SetMaxQueueDepth(CVarMcpQueueDepth.GetValueOnAnyThread());
+    for (const FMCPBatchCall& Call : WorkerCalls)
+    {
+        const bool bQueued = WorkerPool.TryEnqueue([this, Batch, Call, FinishTask]()
+        {
+            FMCPSessionScope SessionScope(Call.Context.GetSession());
+            Call.Tool->ExecuteAsync(Call.Arguments, Call.Context).Next([this, Batch, Call, FinishTask](FMCPToolResult ToolResult)
+            {
+                Batch->Responses[Call.Index] = FMCPResponse::ToolCallSuccess(Call.Id, ToolResult);
+                UntrackCall(Call.Id, Call.Context);
+                FinishTask();
+            });
+        },
+        [this, Batch, Call, FinishTask]()
+        {
+            Batch->Responses[Call.Index] = ToUtf8(FMCPResponse::Error(Call.Id, MCPErrorCodes::InternalError, TEXT("Server is shutting down")));
+            UntrackCall(Call.Id, Call.Context);
+            FinishTask();
+        });
+
+        if (!bQueued)
+        {
+            Batch->Responses[Call.Index] = ToUtf8(FMCPResponse::Error(Call.Id, MCPErrorCodes::ServerBusy,
+                FString::Printf(TEXT("Server busy: %d requests already queued"), WorkerPool.GetQueueDepth())));
+            UntrackCall(Call.Id, Call.Context);
+            FinishTask();
+        }
+    }
+
+    return true;
+}
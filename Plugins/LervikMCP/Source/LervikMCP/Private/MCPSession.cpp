@@ -1,12 +1,88 @@
 #include "MCPSession.h"
-#include "Misc/Base64.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/ScopeRWLock.h"
 
-FMCPSession FMCPSessionManager::CreateSession(const FString& ClientName, const FString& ClientVersion, const FString& ProtocolVersion)
+static TAutoConsoleVariable<float> CVarMcpSessionIdleTimeoutSeconds(
+    TEXT("mcp.session_idle_timeout_seconds"), 1800.0f,
+    TEXT("Seconds without a request after which an MCP session is dropped and its compact IDs forgotten. 0 keeps sessions forever"),
+    ECVF_Default);
+
+namespace
+{
+    /** Innermost FMCPSessionScope on this thread. The scope holds the reference that keeps it alive. */
+    thread_local FMCPSessionState* GCurrentSession = nullptr;
+
+    /** Longest gap between idle sweeps. Short timeouts are swept every quarter timeout instead. */
+    constexpr double MaxSweepIntervalSeconds = 60.0;
+}
+
+FMCPSessionState::FMCPSessionState(const FMCPSession& InInfo, bool bInPinned)
+    : Info(InInfo)
+    , bPinned(bInPinned)
+{
+    Touch();
+}
+
+void FMCPSessionState::Touch()
+{
+    LastActiveCycles = FPlatformTime::Cycles64();
+}
+
+double FMCPSessionState::GetIdleSeconds() const
 {
-    if (CurrentSession.IsSet())
+    return FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - LastActiveCycles.Load());
+}
+
+bool FMCPSessionState::TryConsumeCall(double RatePerSecond, double Burst)
+{
+    if (RatePerSecond <= 0.0)
+    {
+        return true;
+    }
+
+    const double Capacity = FMath::Max(1.0, Burst);
+    const double Now = FPlatformTime::Seconds();
+
+    FScopeLock ScopeLock(&RateLock);
+    if (Tokens < 0.0)
+    {
+        Tokens = Capacity;
+    }
+    else
     {
-        return CurrentSession.GetValue();
+        Tokens = FMath::Min(Capacity, Tokens + (Now - LastRefillSeconds) * RatePerSecond);
     }
+    LastRefillSeconds = Now;
+
+    if (Tokens < 1.0)
+    {
+        return false;
+    }
+    Tokens -= 1.0;
+    return true;
+}
+
+FMCPSessionScope::FMCPSessionScope(FMCPSessionStatePtr InSession)
+    : Session(MoveTemp(InSession))
+    , Previous(GCurrentSession)
+{
+    GCurrentSession = Session.Get();
+}
+
+FMCPSessionScope::~FMCPSessionScope()
+{
+    GCurrentSession = Previous;
+}
+
+FMCPSessionStatePtr FMCPSessionScope::GetCurrent()
+{
+    return GCurrentSession ? FMCPSessionStatePtr(GCurrentSession->AsShared()) : FMCPSessionStatePtr();
+}
+
+FMCPSession FMCPSessionManager::CreateSession(const FString& ClientName, const FString& ClientVersion, const FString& ProtocolVersion, bool bPinned)
+{
+    MaybeEvictIdleSessions();
 
     FMCPSession Session;
     Session.SessionId = FGuid::NewGuid();
@@ -15,108 +91,144 @@ FMCPSession FMCPSessionManager::CreateSession(const FString& ClientName, const F
     Session.ProtocolVersion = ProtocolVersion;
     Session.CreatedAt = FDateTime::UtcNow();
 
-    CurrentSession = Session;
-    ResetGuidMap();
+    FShard& Shard = GetShard(Session.SessionId);
+    {
+        FWriteScopeLock WriteLock(Shard.Lock);
+        Shard.Sessions.Add(Session.SessionId, MakeShared<FMCPSessionState, ESPMode::ThreadSafe>(Session, bPinned));
+    }
+    ++NumSessions;
     return Session;
 }
 
-bool FMCPSessionManager::HasSession() const
+FMCPSessionStatePtr FMCPSessionManager::FindSession(const FGuid& SessionId)
 {
-    return CurrentSession.IsSet();
-}
+    MaybeEvictIdleSessions();
 
-const FMCPSession* FMCPSessionManager::GetSession() const
-{
-    return CurrentSession.IsSet() ? &CurrentSession.GetValue() : nullptr;
+    FMCPSessionStatePtr Found;
+    {
+        const FShard& Shard = GetShard(SessionId);
+        FReadScopeLock ReadLock(Shard.Lock);
+        if (const FMCPSessionStatePtr* Entry = Shard.Sessions.Find(SessionId))
+        {
+            Found = *Entry;
+        }
+    }
+
+    if (Found.IsValid())
+    {
+        Found->Touch();
+    }
+    return Found;
 }
 
-void FMCPSessionManager::DestroySession()
+bool FMCPSessionManager::HasSession() const
 {
-    CurrentSession.Reset();
-    ResetGuidMap();
+    return NumSessions.Load() > 0;
 }
 
-void FMCPSessionManager::ResetGuidMap()
+int32 FMCPSessionManager::Num() const
 {
-    FScopeLock Lock(&GuidMapLock);
-    GuidToIndexMap.Empty();
-    IndexToGuidArray.Empty();
-    NextGuidIndex = 0;
+    return NumSessions.Load();
 }
 
-FString FMCPSessionManager::GuidToCompact(const FGuid& Guid)
+TArray<FMCPSession> FMCPSessionManager::GetSessions() const
 {
-    FScopeLock Lock(&GuidMapLock);
-    int32* Found = GuidToIndexMap.Find(Guid);
-    int32 Index;
-    if (Found)
+    TArray<FMCPSession> Result;
+    for (const FShard& Shard : Shards)
     {
-        Index = *Found;
+        FReadScopeLock ReadLock(Shard.Lock);
+        for (const TPair<FGuid, FMCPSessionStatePtr>& Pair : Shard.Sessions)
+        {
+            Result.Add(Pair.Value->GetInfo());
+        }
     }
-    else
+    Result.Sort([](const FMCPSession& A, const FMCPSession& B) { return A.CreatedAt < B.CreatedAt; });
+    return Result;
+}
+
+bool FMCPSessionManager::DestroySession(const FGuid& SessionId)
+{
+    FShard& Shard = GetShard(SessionId);
+    FWriteScopeLock WriteLock(Shard.Lock);
+    if (Shard.Sessions.Remove(SessionId) > 0)
     {
-        Index = NextGuidIndex++;
-        GuidToIndexMap.Add(Guid, Index);
-        IndexToGuidArray.Add(Guid);
+        --NumSessions;
+        return true;
     }
+    return false;
+}
 
-    // Encode index as minimal big-endian bytes, then base64
-    TArray<uint8> Bytes;
-    if (Index == 0)
+void FMCPSessionManager::DestroyAllSessions()
+{
+    for (FShard& Shard : Shards)
     {
-        Bytes.Add(0);
+        FWriteScopeLock WriteLock(Shard.Lock);
+        NumSessions -= Shard.Sessions.Num();
+        Shard.Sessions.Reset();
     }
-    else
+    SharedGuidTable.Reset();
+}
+
+int32 FMCPSessionManager::EvictIdleSessions(double MaxIdleSeconds)
+{
+    int32 NumEvicted = 0;
+    for (FShard& Shard : Shards)
     {
-        int32 Temp = Index;
-        while (Temp > 0)
+        FWriteScopeLock WriteLock(Shard.Lock);
+        for (auto It = Shard.Sessions.CreateIterator(); It; ++It)
         {
-            Bytes.Insert(static_cast<uint8>(Temp & 0xFF), 0);
-            Temp >>= 8;
+            if (!It->Value->IsPinned() && It->Value->GetIdleSeconds() > MaxIdleSeconds)
+            {
+                It.RemoveCurrent();
+                ++NumEvicted;
+            }
         }
     }
-    FString B64 = FBase64::Encode(Bytes.GetData(), Bytes.Num());
-    // Strip trailing '='
-    while (B64.Len() > 0 && B64[B64.Len() - 1] == TEXT('='))
-    {
-        B64.LeftChopInline(1);
-    }
-    return B64;
+    NumSessions -= NumEvicted;
+    return NumEvicted;
 }
 
-FGuid FMCPSessionManager::CompactToGuid(const FString& Compact)
+void FMCPSessionManager::MaybeEvictIdleSessions()
 {
-    // Try raw GUID parse first (backward compat)
-    FGuid RawGuid;
-    if (Compact.Len() == 32 && FGuid::Parse(Compact, RawGuid))
+    const double TimeoutSeconds = CVarMcpSessionIdleTimeoutSeconds.GetValueOnAnyThread();
+    if (TimeoutSeconds <= 0.0)
     {
-        return RawGuid;
+        return;
     }
 
-    // Re-pad base64
-    FString Padded = Compact;
-    while (Padded.Len() % 4 != 0)
+    const uint64 Now = FPlatformTime::Cycles64();
+    uint64 NextSweep = NextSweepCycles.Load();
+    if (Now < NextSweep)
     {
-        Padded += TEXT("=");
+        return;
     }
 
-    TArray<uint8> Bytes;
-    if (!FBase64::Decode(Padded, Bytes))
+    // Only the thread that moves the deadline forward sweeps; the rest carry on.
+    const double IntervalSeconds = FMath::Min(MaxSweepIntervalSeconds, TimeoutSeconds * 0.25);
+    const uint64 NewNextSweep = Now + (uint64)(IntervalSeconds / FPlatformTime::GetSecondsPerCycle64());
+    if (NextSweepCycles.CompareExchange(NextSweep, NewNextSweep))
     {
-        return FGuid();
+        EvictIdleSessions(TimeoutSeconds);
     }
+}
 
-    // Reconstruct index from big-endian bytes
-    int32 Index = 0;
-    for (uint8 B : Bytes)
-    {
-        Index = (Index << 8) | B;
-    }
+FMCPCompactGuidTable& FMCPSessionManager::GetCurrentGuidTable()
+{
+    FMCPSessionState* Current = GCurrentSession;
+    return Current ? Current->GetGuidTable() : SharedGuidTable;
+}
 
-    FScopeLock Lock(&GuidMapLock);
-    if (IndexToGuidArray.IsValidIndex(Index))
-    {
-        return IndexToGuidArray[Index];
-    }
-    return FGuid();
+void FMCPSessionManager::ResetGuidMap()
+{
+    GetCurrentGuidTable().Reset();
+}
+
+FString FMCPSessionManager::GuidToCompact(const FGuid& Guid)
+{
+    return GetCurrentGuidTable().ToCompact(Guid);
+}
+
+FGuid FMCPSessionManager::CompactToGuid(const FString& Compact)
+{
+    return GetCurrentGuidTable().FromCompact(Compact);
 }
@@ -0,0 +1,39 @@
+#include "MCPToolContext.h"
+
+FMCPToolContext::FMCPToolContext(FProgressHandler&& InProgressHandler, FMCPSessionStatePtr InSession)
+    : State(MakeShared<FState, ESPMode::ThreadSafe>())
+{
+    State->ProgressHandler = MoveTemp(InProgressHandler);
+    State->Session = MoveTemp(InSession);
+}
+
+bool FMCPToolContext::WantsProgress() const
+{
+    return State.IsValid() && State->ProgressHandler;
+}
+
+void FMCPToolContext::ReportProgress(double Progress, double Total, const FString& Message) const
+{
+    if (WantsProgress())
+    {
+        State->ProgressHandler(Progress, Total, Message);
+    }
+}
+
+bool FMCPToolContext::IsCancelled() const
+{
+    return State.IsValid() && State->bCancelled.Load(EMemoryOrder::Relaxed);
+}
+
+void FMCPToolContext::Cancel() const
+{
+    if (State.IsValid())
+    {
+        State->bCancelled = true;
+    }
+}
+
+FMCPSessionStatePtr FMCPToolContext::GetSession() const
+{
+    return State.IsValid() ? State->Session : FMCPSessionStatePtr();
+}
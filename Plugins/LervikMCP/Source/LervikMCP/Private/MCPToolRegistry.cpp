@@ -0,0 +1,137 @@
+#include "MCPToolRegistry.h"
+#include "IMCPTool.h"
+#include "Features/IModularFeatures.h"
+
+FMCPToolRegistry::~FMCPToolRegistry()
+{
+    Shutdown();
+}
+
+void FMCPToolRegistry::Initialize()
+{
+    if (RegisteredHandle.IsValid())
+    {
+        return;
+    }
+
+    IModularFeatures& Features = IModularFeatures::Get();
+    RegisteredHandle = Features.OnModularFeatureRegistered().AddRaw(this, &FMCPToolRegistry::HandleModularFeatureChanged);
+    UnregisteredHandle = Features.OnModularFeatureUnregistered().AddRaw(this, &FMCPToolRegistry::HandleModularFeatureChanged);
+    bDirty = true;
+}
+
+void FMCPToolRegistry::Shutdown()
+{
+    if (RegisteredHandle.IsValid())
+    {
+        IModularFeatures& Features = IModularFeatures::Get();
+        Features.OnModularFeatureRegistered().Remove(RegisteredHandle);
+        Features.OnModularFeatureUnregistered().Remove(UnregisteredHandle);
+        RegisteredHandle.Reset();
+        UnregisteredHandle.Reset();
+    }
+
+    FWriteScopeLock WriteLock(Lock);
+    Tools.Empty();
+    ToolInfos.Empty();
+    ToolIndexByName.Empty();
+    bDirty = true;
+}
+
+void FMCPToolRegistry::HandleModularFeatureChanged(const FName& Type, IModularFeature* ModularFeature)
+{
+    // Runs under the modular feature lock, so only flag the change; the rebuild happens on next lookup.
+    if (Type == IMCPTool::GetModularFeatureName())
+    {
+        bDirty = true;
+        ++Generation;
+    }
+}
+
+void FMCPToolRegistry::RebuildIfDirty()
+{
+    if (!bDirty.Load())
+    {
+        return;
+    }
+
+    // Clear before gathering so a registration racing with the rebuild marks us dirty again.
+    bDirty = false;
+
+    TArray<IMCPTool*> NewTools;
+    TArray<FMCPToolInfo> NewInfos;
+    {
+        IModularFeatures::FScopedLockModularFeatureList ScopedLock;
+        NewTools = IModularFeatures::Get().GetModularFeatureImplementations<IMCPTool>(IMCPTool::GetModularFeatureName());
+        NewInfos.Reserve(NewTools.Num());
+        for (IMCPTool* Tool : NewTools)
+        {
+            NewInfos.Add(Tool->GetToolInfo());
+        }
+    }
+
+    TMap<FName, int32> NewIndexByName;
+    NewIndexByName.Reserve(NewTools.Num());
+    for (int32 i = 0; i < NewTools.Num(); ++i)
+    {
+        // First registration wins, matching the old linear scan.
+        if (!NewIndexByName.Contains(NewInfos[i].Name))
+        {
+            NewIndexByName.Add(NewInfos[i].Name, i);
+        }
+    }
+
+    FWriteScopeLock WriteLock(Lock);
+    Tools = MoveTemp(NewTools);
+    ToolInfos = MoveTemp(NewInfos);
+    ToolIndexByName = MoveTemp(NewIndexByName);
+}
+
+IMCPTool* FMCPToolRegistry::FindTool(FName ToolName, bool* bOutRunsOnGameThread)
+{
+    RebuildIfDirty();
+
+    FReadScopeLock ReadLock(Lock);
+    const int32* Found = ToolIndexByName.Find(ToolName);
+    if (!Found)
+    {
+        return nullptr;
+    }
+    if (bOutRunsOnGameThread)
+    {
+        *bOutRunsOnGameThread = ToolInfos[*Found].bRunsOnGameThread;
+    }
+    return Tools[*Found];
+}
+
+IMCPTool* FMCPToolRegistry::FindTool(const FString& ToolName, bool* bOutRunsOnGameThread)
+{
+    // FNAME_Find never adds to the name table; an unknown name can't be a registered tool.
+    const FName Name(*ToolName, FNAME_Find);
+    if (Name.IsNone())
+    {
+        return nullptr;
+    }
+    return FindTool(Name, bOutRunsOnGameThread);
+}
+
+TArray<IMCPTool*> FMCPToolRegistry::GetTools()
+{
+    RebuildIfDirty();
+
+    FReadScopeLock ReadLock(Lock);
+    return Tools;
+}
+
+TArray<FMCPToolInfo> FMCPToolRegistry::GetToolInfos()
+{
+    RebuildIfDirty();
+
+    FReadScopeLock ReadLock(Lock);
+    return ToolInfos;
+}
+
+uint32 FMCPToolRegistry::GetGeneration() const
+{
+    return Generation.Load();
+}
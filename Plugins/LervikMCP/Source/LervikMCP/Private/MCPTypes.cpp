@@ -1,4 +1,5 @@
 #include "MCPTypes.h"
+#include "MCPJsonWriter.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonWriter.h"
 #include "Serialization/JsonSerializer.h"
@@ -11,6 +12,14 @@ FMCPToolResult FMCPToolResult::Text(const FString& InContent)
     return Result;
 }
 
+FMCPToolResult FMCPToolResult::Utf8(TArray<uint8>&& InContentUtf8)
+{
+    FMCPToolResult Result;
+    Result.ContentUtf8 = MoveTemp(InContentUtf8);
+    Result.bIsError = false;
+    return Result;
+}
+
 FMCPToolResult FMCPToolResult::Error(const FString& ErrorMessage)
 {
     FMCPToolResult Result;
@@ -19,14 +28,27 @@ FMCPToolResult FMCPToolResult::Error(const FString& ErrorMessage)
     return Result;
 }
 
-bool FMCPRequest::Parse(const FString& JsonString, FMCPRequest& OutRequest, FString& OutError)
+FMCPToolResult FMCPToolResult::Cancelled()
 {
-    TSharedPtr<FJsonObject> JsonObject;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    return Error(TEXT("Request cancelled"));
+}
+
+FString FMCPToolResult::GetText() const
+{
+    if (ContentUtf8.Num() > 0)
     {
-        OutError = TEXT("Invalid JSON");
-        return false;
+        FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(ContentUtf8.GetData()), ContentUtf8.Num());
+        return FString(Converted.Length(), Converted.Get());
+    }
+    return Content;
+}
+
+static bool ParseRequestObject(const TSharedPtr<FJsonObject>& JsonObject, FMCPRequest& OutRequest, FString& OutError)
+{
+    OutRequest.bIsNotification = !JsonObject->HasField(TEXT("id"));
+    if (!OutRequest.bIsNotification)
+    {
+        OutRequest.Id = JsonObject->TryGetField(TEXT("id"));
     }
 
     FString JsonRpcVersion;
@@ -52,15 +74,86 @@ bool FMCPRequest::Parse(const FString& JsonString, FMCPRequest& OutRequest, FStr
         }
     }
 
-    OutRequest.bIsNotification = !JsonObject->HasField(TEXT("id"));
-    if (!OutRequest.bIsNotification)
+    return true;
+}
+
+bool FMCPRequest::Parse(const FString& JsonString, FMCPRequest& OutRequest, FString& OutError)
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
     {
-        OutRequest.Id = JsonObject->TryGetField(TEXT("id"));
+        OutError = TEXT("Invalid JSON");
+        return false;
+    }
+
+    return ParseRequestObject(JsonObject, OutRequest, OutError);
+}
+
+static bool ParseMessageValue(const TSharedPtr<FJsonValue>& JsonValue, TArray<FMCPRequest>& OutRequests, bool& bOutIsBatch, FString& OutError)
+{
+    if (JsonValue->Type == EJson::Object)
+    {
+        FMCPRequest& Request = OutRequests.AddDefaulted_GetRef();
+        return ParseRequestObject(JsonValue->AsObject(), Request, OutError);
+    }
+
+    if (JsonValue->Type != EJson::Array)
+    {
+        OutError = TEXT("Invalid JSON");
+        return false;
     }
 
+    bOutIsBatch = true;
+    const TArray<TSharedPtr<FJsonValue>>& Entries = JsonValue->AsArray();
+    OutRequests.Reserve(Entries.Num());
+    for (const TSharedPtr<FJsonValue>& Entry : Entries)
+    {
+        FMCPRequest& Request = OutRequests.AddDefaulted_GetRef();
+        if (!Entry.IsValid() || Entry->Type != EJson::Object)
+        {
+            Request.ParseError = TEXT("Batch entry is not an object");
+            continue;
+        }
+        FString EntryError;
+        if (!ParseRequestObject(Entry->AsObject(), Request, EntryError))
+        {
+            Request.ParseError = EntryError;
+        }
+    }
     return true;
 }
 
+bool FMCPRequest::ParseMessage(const FString& JsonString, TArray<FMCPRequest>& OutRequests, bool& bOutIsBatch, FString& OutError)
+{
+    bOutIsBatch = false;
+
+    TSharedPtr<FJsonValue> JsonValue;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+    if (!FJsonSerializer::Deserialize(Reader, JsonValue) || !JsonValue.IsValid())
+    {
+        OutError = TEXT("Invalid JSON");
+        return false;
+    }
+
+    return ParseMessageValue(JsonValue, OutRequests, bOutIsBatch, OutError);
+}
+
+bool FMCPRequest::ParseMessage(FUtf8StringView Utf8Json, TArray<FMCPRequest>& OutRequests, bool& bOutIsBatch, FString& OutError)
+{
+    bOutIsBatch = false;
+
+    TSharedPtr<FJsonValue> JsonValue;
+    TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(Utf8Json);
+    if (!FJsonSerializer::Deserialize(Reader, JsonValue) || !JsonValue.IsValid())
+    {
+        OutError = TEXT("Invalid JSON");
+        return false;
+    }
+
+    return ParseMessageValue(JsonValue, OutRequests, bOutIsBatch, OutError);
+}
+
 static FString SerializeJsonObject(const TSharedPtr<FJsonObject>& Obj)
 {
     if (!Obj.IsValid())
@@ -106,3 +199,64 @@ FString FMCPResponse::Error(const TSharedPtr<FJsonValue>& Id, int32 Code, const
 
     return SerializeJsonObject(Response);
 }
+
+FString FMCPResponse::Notification(const FString& Method, const TSharedPtr<FJsonObject>& Params)
+{
+    TSharedPtr<FJsonObject> Message = MakeShared<FJsonObject>();
+    Message->SetStringField(TEXT("jsonrpc"), TEXT("2.0"));
+    Message->SetStringField(TEXT("method"), Method);
+    if (Params.IsValid())
+    {
+        Message->SetObjectField(TEXT("params"), Params);
+    }
+
+    return SerializeJsonObject(Message);
+}
+
+TArray<uint8> FMCPResponse::SuccessRaw(const TSharedPtr<FJsonValue>& Id, TConstArrayView<uint8> ResultUtf8)
+{
+    FMCPJsonWriter Writer(ResultUtf8.Num() + 64);
+    Writer.BeginObject();
+    Writer.WriteKey("jsonrpc");
+    Writer.WriteString("2.0");
+    Writer.WriteKey("result");
+    Writer.WriteRawValue(ResultUtf8);
+    Writer.WriteKey("id");
+    Writer.WriteValue(Id);
+    Writer.EndObject();
+    return Writer.Take();
+}
+
+TArray<uint8> FMCPResponse::ToolCallSuccess(const TSharedPtr<FJsonValue>& Id, const FMCPToolResult& ToolResult)
+{
+    const bool bUtf8 = ToolResult.ContentUtf8.Num() > 0;
+    FMCPJsonWriter Writer((bUtf8 ? ToolResult.ContentUtf8.Num() : ToolResult.Content.Len()) + 128);
+    Writer.BeginObject();
+    Writer.WriteKey("jsonrpc");
+    Writer.WriteString("2.0");
+    Writer.WriteKey("result");
+    Writer.BeginObject();
+    Writer.WriteKey("content");
+    Writer.BeginArray();
+    Writer.BeginObject();
+    Writer.WriteKey("type");
+    Writer.WriteString("text");
+    Writer.WriteKey("text");
+    if (bUtf8)
+    {
+        Writer.WriteUtf8String(ToolResult.ContentUtf8);
+    }
+    else
+    {
+        Writer.WriteString(ToolResult.Content);
+    }
+    Writer.EndObject();
+    Writer.EndArray();
+    Writer.WriteKey("isError");
+    Writer.WriteBool(ToolResult.bIsError);
+    Writer.EndObject();
+    Writer.WriteKey("id");
+    Writer.WriteValue(Id);
+    Writer.EndObject();
+    return Writer.Take();
+}
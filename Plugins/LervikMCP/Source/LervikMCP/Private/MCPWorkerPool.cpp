@@ -0,0 +1,150 @@
+#include "MCPWorkerPool.h"
+#include "Misc/IQueuedWork.h"
+#include "Misc/QueuedThreadPool.h"
+#include "MCPGameThreadQueue.h"
+#include "Async/Async.h"
+#include "Async/TaskGraphInterfaces.h"
+
+// FQueuedThreadPool defaults to 32 KB stacks, which recursive tools (graph walks, pseudo-C++ generation,
+// nested JSON) overflow. The same tools also run on the game thread, so match the 1 MB a Windows main thread reserves.
+static constexpr uint32 MCPWorkerStackSize = 1024 * 1024;
+
+class FMCPQueuedWork : public IQueuedWork
+{
+public:
+    FMCPQueuedWork(FMCPWorkerPool& InPool, TUniqueFunction<void()>&& InWork, TUniqueFunction<void()>&& InOnAbandoned)
+        : Pool(InPool), Work(MoveTemp(InWork)), OnAbandoned(MoveTemp(InOnAbandoned))
+    {
+    }
+
+    virtual void DoThreadedWork() override
+    {
+        --Pool.PendingCount;
+        ++Pool.ActiveCount;
+        Work();
+        --Pool.ActiveCount;
+        delete this;
+    }
+
+    virtual void Abandon() override
+    {
+        --Pool.PendingCount;
+        if (OnAbandoned)
+        {
+            OnAbandoned();
+        }
+        delete this;
+    }
+
+private:
+    FMCPWorkerPool& Pool;
+    TUniqueFunction<void()> Work;
+    TUniqueFunction<void()> OnAbandoned;
+};
+
+FMCPWorkerPool::~FMCPWorkerPool()
+{
+    Stop();
+}
+
+bool FMCPWorkerPool::Start(int32 InNumWorkers, int32 InMaxQueueDepth)
+{
+    if (ThreadPool)
+    {
+        return true;
+    }
+
+    NumWorkers = FMath::Max(1, InNumWorkers);
+    SetMaxQueueDepth(InMaxQueueDepth);
+    PendingCount = 0;
+    ActiveCount = 0;
+
+    ThreadPool = FQueuedThreadPool::Allocate();
+    if (!ThreadPool->Create(NumWorkers, MCPWorkerStackSize, TPri_Normal, TEXT("MCPWorkerPool")))
+    {
+        delete ThreadPool;
+        ThreadPool = nullptr;
+        NumWorkers = 0;
+        return false;
+    }
+    return true;
+}
+
+void FMCPWorkerPool::Stop()
+{
+    if (!ThreadPool)
+    {
+        return;
+    }
+
+    // Destroy() abandons queued work and blocks until running work completes. A running tool may itself be
+    // blocked on ExecuteOnGameThread, so when stopping from the game thread, join elsewhere and keep running
+    // game-thread work until the workers are gone.
+    if (IsInGameThread())
+    {
+        FQueuedThreadPool* Pool = ThreadPool;
+        TFuture<void> Destroyed = Async(EAsyncExecution::Thread, [Pool]() { Pool->Destroy(); });
+        while (!Destroyed.WaitFor(FTimespan::FromMilliseconds(10.0)))
+        {
+            FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+            FMCPGameThreadQueue::Get().PumpAll();
+        }
+        // Abandoned items may have queued their replies for the game thread.
+        FMCPGameThreadQueue::Get().PumpAll();
+    }
+    else
+    {
+        ThreadPool->Destroy();
+    }
+    delete ThreadPool;
+    ThreadPool = nullptr;
+    NumWorkers = 0;
+}
+
+bool FMCPWorkerPool::IsRunning() const
+{
+    return ThreadPool != nullptr;
+}
+
+bool FMCPWorkerPool::TryEnqueue(TUniqueFunction<void()>&& Work, TUniqueFunction<void()>&& OnAbandoned)
+{
+    if (!ThreadPool)
+    {
+        return false;
+    }
+
+    // Reserve a slot first so concurrent callers can't overshoot the limit.
+    if (++PendingCount > MaxQueueDepth.Load())
+    {
+        --PendingCount;
+        return false;
+    }
+
+    ThreadPool->AddQueuedWork(new FMCPQueuedWork(*this, MoveTemp(Work), MoveTemp(OnAbandoned)));
+    return true;
+}
+
+int32 FMCPWorkerPool::GetQueueDepth() const
+{
+    return PendingCount.Load();
+}
+
+int32 FMCPWorkerPool::GetActiveCount() const
+{
+    return ActiveCount.Load();
+}
+
+int32 FMCPWorkerPool::GetNumWorkers() const
+{
+    return NumWorkers;
+}
+
+int32 FMCPWorkerPool::GetMaxQueueDepth() const
+{
+    return MaxQueueDepth.Load();
+}
+
+void FMCPWorkerPool::SetMaxQueueDepth(int32 InMaxQueueDepth)
+{
+    MaxQueueDepth = FMath::Max(1, InMaxQueueDepth);
+}
@@ -56,12 +56,17 @@ FMCPToolInfo FMCPTool_Execute::GetToolInfo() const
 }
 
 FMCPToolResult FMCPTool_Execute::Execute(const TSharedPtr<FJsonObject>& Params)
+{
+    return ExecuteAsync(Params, FMCPToolContext()).Get();
+}
+
+TFuture<FMCPToolResult> FMCPTool_Execute::ExecuteAsync(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context)
 {
     FMCPToolResult HelpResult;
     if (MCPToolHelp::CheckAndHandleHelp(Params, sRtExecHelp, HelpResult))
-        return HelpResult;
+        return MakeFulfilledPromise<FMCPToolResult>(MoveTemp(HelpResult)).GetFuture();
 
-    return ExecuteOnGameThread([Params]() -> FMCPToolResult
+    return ExecuteOnGameThreadAsync(Context, [Params]() -> FMCPToolResult
     {
         FString Action;
         if (!Params->TryGetStringField(TEXT("action"), Action))
@@ -152,10 +157,11 @@ FMCPToolResult FMCPTool_Execute::Execute(const TSharedPtr<FJsonObject>& Params)
                 }
             }
 
+            const FMCPCompiledPattern FilterPattern = FMCPSearchPatterns::Compile(Filter);
             auto CollectObject = [&](const TCHAR* Name, IConsoleObject* ConsoleObj)
             {
                 FString NameStr(Name);
-                if (!Filter.IsEmpty() && !FMCPSearchPatterns::Matches(Filter, NameStr))
+                if (!FilterPattern.Matches(NameStr))
                 {
                     return;
                 }
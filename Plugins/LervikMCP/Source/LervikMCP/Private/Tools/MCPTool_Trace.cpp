@@ -1,30 +1,35 @@
 #include "Tools/MCPTool_Trace.h"
 #include "MCPGameThreadHelper.h"
 #include "MCPJsonHelpers.h"
+#include "MCPJsonWriter.h"
 #include "MCPToolHelp.h"
 #include "Tools/TraceAnalyzer.h"
 
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
 #include "ProfilingDebugging/TraceAuxiliary.h"
+#include "HAL/PlatformProcess.h"
 
 namespace {
 
-TSharedPtr<FJsonObject> TimingNodeToJson(const FTraceTimingNode& Node)
+void WriteTimingNode(FMCPJsonWriter& Writer, const FTraceTimingNode& Node)
 {
-    TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
-    Obj->SetStringField(TEXT("name"),   Node.Name);
-    Obj->SetNumberField(TEXT("count"),  Node.Count);
-    Obj->SetField(TEXT("avg_ms"), FMCPJsonHelpers::RoundedJsonNumber(Node.GetAvgMs()));
-    Obj->SetField(TEXT("min_ms"), FMCPJsonHelpers::RoundedJsonNumber(Node.Count > 0 ? Node.MinMs : 0.0));
-    Obj->SetField(TEXT("max_ms"), FMCPJsonHelpers::RoundedJsonNumber(Node.MaxMs));
-
-    TArray<TSharedPtr<FJsonValue>> ChildArray;
+    Writer.BeginObject();
+    Writer.WriteKey("name");   Writer.WriteString(Node.Name);
+    Writer.WriteKey("count");  Writer.WriteInteger(Node.Count);
+    Writer.WriteKey("avg_ms"); Writer.WriteFixed(Node.GetAvgMs());
+    Writer.WriteKey("min_ms"); Writer.WriteFixed(Node.Count > 0 ? Node.MinMs : 0.0);
+    Writer.WriteKey("max_ms"); Writer.WriteFixed(Node.MaxMs);
+    Writer.WriteKey("p50_ms"); Writer.WriteFixed(Node.GetPercentileMs(0.5));
+    Writer.WriteKey("p90_ms"); Writer.WriteFixed(Node.GetPercentileMs(0.9));
+    Writer.WriteKey("p99_ms"); Writer.WriteFixed(Node.GetPercentileMs(0.99));
+
+    Writer.WriteKey("children");
+    Writer.BeginArray();
     for (const auto& Child : Node.Children)
-        ChildArray.Add(MakeShared<FJsonValueObject>(TimingNodeToJson(Child)));
-    Obj->SetArrayField(TEXT("children"), ChildArray);
-
-    return Obj;
+        WriteTimingNode(Writer, Child);
+    Writer.EndArray();
+    Writer.EndObject();
 }
 
 // ── Help data ────────────────────────────────────────────────────────────
@@ -37,7 +42,7 @@ static const FMCPParamHelp sTraceAnalyzeParams[] = {
     { TEXT("path"),   TEXT("string"),  true,  TEXT("Required .utrace file path to analyze"), nullptr, nullptr },
     { TEXT("depth"),  TEXT("integer"), false, TEXT("Tree depth levels for GPU and CPU. Default: 1"), nullptr, TEXT("2") },
     { TEXT("min_ms"), TEXT("number"),  false, TEXT("Min avg ms filter threshold. Default: 0.1"), nullptr, TEXT("0.5") },
-    { TEXT("filter"), TEXT("string"),  false, TEXT("Case-insensitive substring filter on node names. Overrides depth limit"), nullptr, TEXT("Shadow") },
+    { TEXT("filter"), TEXT("string"),  false, TEXT("Case-insensitive filter on node names: substring, wildcards, comma OR or /regex/. Overrides depth limit"), nullptr, TEXT("Shadow") },
 };
 
 static const FMCPActionHelp sTraceActions[] = {
@@ -68,13 +73,25 @@ FMCPToolInfo FMCPTool_Trace::GetToolInfo() const
         { TEXT("path"),     TEXT("[analyze] Required .utrace file path. [start] Optional output path"),   TEXT("string"),  false },
         { TEXT("depth"),    TEXT("[analyze] Tree depth levels for GPU and CPU. Default: 1"),              TEXT("integer"), false },
         { TEXT("min_ms"),   TEXT("[analyze] Min avg ms filter threshold. Default: 0.1"),                  TEXT("number"),  false },
-        { TEXT("filter"),   TEXT("[analyze] Case-insensitive substring filter on node names. Overrides depth limit"), TEXT("string"), false },
+        { TEXT("filter"),   TEXT("[analyze] Case-insensitive filter on node names: substring, wildcards, comma OR or /regex/. Overrides depth limit"), TEXT("string"), false },
         { TEXT("help"),     TEXT("Pass help=true for overview, help='action_name' for detailed parameter info"), TEXT("string"), false },
     };
+    // analyze/stop/test block on file I/O or sleeps and hop to the game thread themselves
+    Info.bRunsOnGameThread = false;
     return Info;
 }
 
 FMCPToolResult FMCPTool_Trace::Execute(const TSharedPtr<FJsonObject>& Params)
+{
+    return Run(Params, FMCPToolContext());
+}
+
+TFuture<FMCPToolResult> FMCPTool_Trace::ExecuteAsync(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context)
+{
+    return MakeFulfilledPromise<FMCPToolResult>(Run(Params, Context)).GetFuture();
+}
+
+FMCPToolResult FMCPTool_Trace::Run(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context)
 {
     FMCPToolResult HelpResult;
     if (MCPToolHelp::CheckAndHandleHelp(Params, sTraceHelp, HelpResult))
@@ -117,31 +134,54 @@ FMCPToolResult FMCPTool_Trace::Execute(const TSharedPtr<FJsonObject>& Params)
         FString Filter;
         Params->TryGetStringField(TEXT("filter"), Filter);
 
-        FTraceAnalysisResult R = FTraceAnalyzer::Analyze(Path, DepthLimit, MinMsThreshold, Filter);
+        Context.ReportProgress(0, 2, FString::Printf(TEXT("Analyzing %s"), *Path));
+        FTraceAnalysisResult R = FTraceAnalyzer::Analyze(Path, DepthLimit, MinMsThreshold, Filter, Context);
         if (!R.Error.IsEmpty())
             return FMCPToolResult::Error(R.Error);
+        Context.ReportProgress(1, 2, TEXT("Building result"));
+
+        // Timing trees can run to thousands of nodes, so the reply is written straight to UTF-8.
+        FMCPJsonWriter Writer;
+        Writer.BeginObject();
+        Writer.WriteKey("action");             Writer.WriteString(TEXT("analyze"));
+        Writer.WriteKey("path");               Writer.WriteString(R.FilePath);
+        Writer.WriteKey("frame_count");        Writer.WriteInteger(R.FrameStats.FrameCount);
+        Writer.WriteKey("render_frame_count"); Writer.WriteInteger(R.RenderPassCount);
+        Writer.WriteKey("avg_frame_time_ms");  Writer.WriteFixed(R.FrameStats.AvgFrameTimeMs);
+        Writer.WriteKey("min_frame_time_ms");  Writer.WriteFixed(R.FrameStats.MinFrameTimeMs);
+        Writer.WriteKey("max_frame_time_ms");  Writer.WriteFixed(R.FrameStats.MaxFrameTimeMs);
+        Writer.WriteKey("p50_frame_time_ms");  Writer.WriteFixed(R.FrameStats.GetPercentileMs(0.5));
+        Writer.WriteKey("p90_frame_time_ms");  Writer.WriteFixed(R.FrameStats.GetPercentileMs(0.9));
+        Writer.WriteKey("p99_frame_time_ms");  Writer.WriteFixed(R.FrameStats.GetPercentileMs(0.99));
+
+        // [upper_ms, count] pairs at two buckets per octave; fine enough to spot hitches without flooding the reply.
+        Writer.WriteKey("frame_time_histogram");
+        Writer.BeginArray();
+        for (const TPair<double, uint32>& Bucket : R.FrameStats.Histogram.GetCoarseBuckets(2))
+        {
+            Writer.BeginArray();
+            Writer.WriteFixed(Bucket.Key);
+            Writer.WriteInteger(Bucket.Value);
+            Writer.EndArray();
+        }
+        Writer.EndArray();
 
-        TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
-        Json->SetStringField(TEXT("action"),            TEXT("analyze"));
-        Json->SetStringField(TEXT("path"),              R.FilePath);
-        Json->SetNumberField(TEXT("frame_count"),       R.FrameStats.FrameCount);
-        Json->SetNumberField(TEXT("render_frame_count"), R.RenderPassCount);
-        Json->SetField(TEXT("avg_frame_time_ms"), FMCPJsonHelpers::RoundedJsonNumber(R.FrameStats.AvgFrameTimeMs));
-        Json->SetField(TEXT("min_frame_time_ms"), FMCPJsonHelpers::RoundedJsonNumber(R.FrameStats.MinFrameTimeMs));
-        Json->SetField(TEXT("max_frame_time_ms"), FMCPJsonHelpers::RoundedJsonNumber(R.FrameStats.MaxFrameTimeMs));
-
-        TArray<TSharedPtr<FJsonValue>> GpuArray;
+        Writer.WriteKey("gpu");
+        Writer.BeginArray();
         for (const auto& Node : R.GpuRoot.Children)
-            GpuArray.Add(MakeShared<FJsonValueObject>(TimingNodeToJson(Node)));
-        Json->SetArrayField(TEXT("gpu"), GpuArray);
+            WriteTimingNode(Writer, Node);
+        Writer.EndArray();
 
-        TArray<TSharedPtr<FJsonValue>> CpuArray;
+        Writer.WriteKey("cpu");
+        Writer.BeginArray();
         for (const auto& Node : R.CpuRoot.Children)
-            CpuArray.Add(MakeShared<FJsonValueObject>(TimingNodeToJson(Node)));
-        Json->SetArrayField(TEXT("cpu"), CpuArray);
-        Json->SetNumberField(TEXT("cpu_frame_count"), R.CpuFrameCount);
+            WriteTimingNode(Writer, Node);
+        Writer.EndArray();
+        Writer.WriteKey("cpu_frame_count"); Writer.WriteInteger(R.CpuFrameCount);
+        Writer.WriteKey("cached");          Writer.WriteBool(R.bFromCache || R.bFromSummaryFile);
+        Writer.EndObject();
 
-        return FMCPJsonHelpers::SuccessResponse(Json);
+        return FMCPToolResult::Utf8(Writer.Take());
     }
 
     // stop: validate + stop on game thread, then poll on caller thread
@@ -162,6 +202,8 @@ FMCPToolResult FMCPTool_Trace::Execute(const TSharedPtr<FJsonObject>& Params)
         if (ValidationResult.bIsError)
             return ValidationResult;
 
+        Context.ReportProgress(0, 0, TEXT("Waiting for trace writer to flush"));
+
         // Poll on MCP handler thread — game thread is free
         const double Timeout = FPlatformTime::Seconds() + 5.0;
         while (FTraceAuxiliary::IsConnected() && FPlatformTime::Seconds() < Timeout)
@@ -178,6 +220,7 @@ FMCPToolResult FMCPTool_Trace::Execute(const TSharedPtr<FJsonObject>& Params)
     // test: start trace, sleep 5s, stop trace, return combined result
     if (Action.Equals(TEXT("test"), ESearchCase::IgnoreCase))
     {
+        Context.ReportProgress(0, 3, TEXT("Waiting 5s before starting trace"));
         FPlatformProcess::Sleep(5.0f);
 
         FString StartPath;
@@ -212,6 +255,7 @@ FMCPToolResult FMCPTool_Trace::Execute(const TSharedPtr<FJsonObject>& Params)
         if (StartResult.bIsError)
             return StartResult;
 
+        Context.ReportProgress(1, 3, TEXT("Tracing for 5s"));
         FPlatformProcess::Sleep(5.0f);
 
         FString StopPath;
@@ -229,6 +273,7 @@ FMCPToolResult FMCPTool_Trace::Execute(const TSharedPtr<FJsonObject>& Params)
         if (StopResult.bIsError)
             return StopResult;
 
+        Context.ReportProgress(2, 3, TEXT("Waiting for trace writer to flush"));
         const double Timeout = FPlatformTime::Seconds() + 5.0;
         while (FTraceAuxiliary::IsConnected() && FPlatformTime::Seconds() < Timeout)
             FPlatformProcess::Sleep(0.005f);
@@ -6,5 +6,9 @@ class FMCPTool_Trace : public IMCPTool
 public:
     virtual FMCPToolInfo GetToolInfo() const override;
     virtual FMCPToolResult Execute(const TSharedPtr<FJsonObject>& Params) override;
+    virtual TFuture<FMCPToolResult> ExecuteAsync(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context) override;
 
+private:
+    /** Runs the action on the calling thread, hopping to the game thread only for engine state. */
+    FMCPToolResult Run(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context);
 };
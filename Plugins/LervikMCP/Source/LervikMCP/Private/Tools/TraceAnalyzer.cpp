@@ -1,6 +1,7 @@
 #include "Tools/TraceAnalyzer.h"
 
 #include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
 #include "Math/UnrealMathUtility.h"
 
 #if LERVIKMCP_WITH_TRACE_ANALYSIS
@@ -13,6 +14,25 @@
 #include "TraceServices/Model/Threads.h"
 #include "TraceServices/Model/TimingProfiler.h"
 #include "Misc/EngineVersionComparison.h"
+#include "MCPSearchPatterns.h"
+#include "Containers/LruCache.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Tools/TraceSummaryFile.h"
+#include "Tools/TraceTimingArena.h"
+
+static TAutoConsoleVariable<int32> CVarMcpTraceCacheMB(
+    TEXT("mcp.trace_cache_mb"), 256,
+    TEXT("Memory in MB for parsed .utrace files kept between trace analyze calls. 0 disables the cache"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarMcpTraceSummaryFiles(
+    TEXT("mcp.trace_summary_files"), 1,
+    TEXT("Write a .utrace.mcpsum summary next to analyzed traces and answer later analyze calls from it (1), or always read the trace (0)"),
+    ECVF_Default);
 
 namespace {
 
@@ -30,9 +50,9 @@ void PruneTree(FTraceTimingNode& Node, int32 CurrentDepth, int32 MaxDepth, doubl
     });
 }
 
-bool ShouldKeep(const FTraceTimingNode& Node, const FString& Filter)
+bool ShouldKeep(const FTraceTimingNode& Node, const FMCPCompiledPattern& Filter)
 {
-    if (Node.Name.Contains(Filter, ESearchCase::IgnoreCase))
+    if (Filter.Matches(Node.Name))
         return true;
     for (const FTraceTimingNode& Child : Node.Children)
         if (ShouldKeep(Child, Filter))
@@ -40,7 +60,7 @@ bool ShouldKeep(const FTraceTimingNode& Node, const FString& Filter)
     return false;
 }
 
-void FilterTree(FTraceTimingNode& Node, const FString& Filter)
+void FilterTree(FTraceTimingNode& Node, const FMCPCompiledPattern& Filter)
 {
     Node.Children.RemoveAll([&Filter](const FTraceTimingNode& Child)
     {
@@ -60,76 +80,102 @@ void PruneByMinMs(FTraceTimingNode& Node, double MinMsThreshold)
     });
 }
 
-// Shared tree-building logic for both GPU and CPU timelines.
+// Frame-aligned slice of a timeline. Only top-level scopes starting in [Start, End) are aggregated, with
+// everything below them, so slices never count a scope twice. The first and last slices are open towards
+// the trace edges, which keeps scopes straddling them just like a single pass over the trace.
+struct FTimelineChunk
+{
+    double Start  = 0.0;
+    double End    = 0.0;
+    bool   bFirst = true;
+    bool   bLast  = true;
+};
+
+// Fewer frames than this per chunk cost more in task overhead and merging than they save.
+constexpr int32 MinFramesPerChunk = 64;
+
+// Splits the trace window at frame starts into about one chunk per task-graph worker.
+TArray<FTimelineChunk> MakeTimelineChunks(const TArray<double>& FrameStartTimes, double TraceStartTime, double TraceEndTime)
+{
+    const int32 MaxChunks = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+    const int32 NumChunks = FMath::Clamp(FrameStartTimes.Num() / MinFramesPerChunk, 1, MaxChunks);
+
+    TArray<FTimelineChunk> Chunks;
+    for (int32 i = 0; i < NumChunks; ++i)
+    {
+        FTimelineChunk& Chunk = Chunks.AddDefaulted_GetRef();
+        Chunk.bFirst = i == 0;
+        Chunk.bLast  = i == NumChunks - 1;
+        Chunk.Start  = Chunk.bFirst ? TraceStartTime : FrameStartTimes[(int64)FrameStartTimes.Num() * i / NumChunks];
+        Chunk.End    = Chunk.bLast  ? TraceEndTime   : FrameStartTimes[(int64)FrameStartTimes.Num() * (i + 1) / NumChunks];
+    }
+    return Chunks;
+}
+
+// Shared tree-building logic for both GPU and CPU timelines, over one chunk.
 // Returns the number of top-level scopes (render passes for GPU, frames for CPU).
 int32 BuildTimingTree(
     const TraceServices::ITimingProfilerProvider::Timeline& Timeline,
-    FTraceTimingNode& Root,
-    double StartTime, double EndTime,
-    const TMap<uint32, FString>& TimerNames,
-    const TraceServices::ITimingProfilerProvider* TimingProvider)
+    FTraceTimingArena& Arena,
+    const FTimelineChunk& Chunk, double TraceEndTime,
+    const FTraceTimerNames& TimerNames,
+    const TraceServices::ITimingProfilerProvider* TimingProvider,
+    const FMCPToolContext& Context)
 {
     int32 TopLevelCount = 0;
-    TMap<FTraceTimingNode*, TMap<FString, int32>> SeenCounts;
-    TArray<FTraceTimingNode*> Stack;
-    Stack.Push(&Root);
+    // Scopes per (parent node, NameId) so far in the current top-level scope; the N-th one becomes Name_N.
+    TMap<uint64, uint32> SeenCounts;
+    TArray<int32, TInlineAllocator<64>> Stack;
+    Stack.Push(FTraceTimingArena::RootIndex);
+
+    // A chunk that starts mid-scope first sees the enclosing scope, which belongs to the previous chunk.
+    bool bSkippingScope = !Chunk.bFirst;
 
-    Timeline.EnumerateEvents(StartTime, EndTime,
+    // Enumerate to the trace end and stop at the next chunk's first scope, so the children of this chunk's
+    // last scope are included even when they run past Chunk.End.
+    Timeline.EnumerateEvents(Chunk.Start, TraceEndTime,
         [&](double EvStart, double EvEnd, uint32 Depth, const TraceServices::FTimingProfilerEvent& Event)
             -> TraceServices::EEventEnumerate
         {
             if (Depth == 0)
             {
+                if (Context.IsCancelled())
+                    return TraceServices::EEventEnumerate::Stop;
+                if (!Chunk.bLast && EvStart >= Chunk.End)
+                    return TraceServices::EEventEnumerate::Stop;
+
+                bSkippingScope = !Chunk.bFirst && EvStart < Chunk.Start;
+                if (bSkippingScope)
+                    return TraceServices::EEventEnumerate::Continue;
+
                 TopLevelCount++;
                 SeenCounts.Reset();
                 Stack.SetNum(1);
             }
+            else if (bSkippingScope)
+            {
+                return TraceServices::EEventEnumerate::Continue;
+            }
             else
             {
                 while (Stack.Num() > (int32)(Depth + 1) && Stack.Num() > 1)
                     Stack.Pop();
             }
 
-            FTraceTimingNode* Parent = Stack.Last();
+            const int32 Parent = Stack.Last();
 
             uint32 ResolvedTimerIndex = Event.TimerIndex;
 #if !UE_VERSION_OLDER_THAN(5, 7, 0)
             ResolvedTimerIndex = TimingProvider->GetOriginalTimerIdFromMetadata(ResolvedTimerIndex);
 #endif
 
-            FString BaseName;
-            if (const FString* Found = TimerNames.Find(ResolvedTimerIndex))
-                BaseName = *Found;
-            else
-                BaseName = FString::Printf(TEXT("Timer_%u"), ResolvedTimerIndex);
-
-            TMap<FString, int32>& ParentSeen = SeenCounts.FindOrAdd(Parent);
-            int32& SeenCount = ParentSeen.FindOrAdd(BaseName);
-            FString NodeName = SeenCount == 0
-                ? BaseName
-                : FString::Printf(TEXT("%s_%d"), *BaseName, SeenCount);
-            SeenCount++;
-
-            FTraceTimingNode* Node = nullptr;
-            for (auto& Child : Parent->Children)
-            {
-                if (Child.Name == NodeName) { Node = &Child; break; }
-            }
-            if (!Node)
-            {
-                Parent->Children.Emplace();
-                Node = &Parent->Children.Last();
-                Node->Name = NodeName;
-            }
+            const uint32 NameId = TimerNames.GetNameId(ResolvedTimerIndex);
+            uint32& SeenCount = SeenCounts.FindOrAdd(((uint64)(uint32)Parent << 32) | NameId);
+            const int32 Node = Arena.FindOrAddChild(Parent, NameId, SeenCount++);
 
             double DurationMs = (EvEnd - EvStart) * 1000.0;
             if (FMath::IsFinite(DurationMs) && DurationMs >= 0.0)
-            {
-                Node->Count++;
-                Node->TotalMs += DurationMs;
-                Node->MinMs = FMath::Min(Node->MinMs, DurationMs);
-                Node->MaxMs = FMath::Max(Node->MaxMs, DurationMs);
-            }
+                Arena.AddSample(Node, DurationMs);
 
             Stack.Push(Node);
             return TraceServices::EEventEnumerate::Continue;
@@ -182,38 +228,142 @@ FTraceTimingNode* FindCpuStartingPoint(FTraceTimingNode& Node)
     return TickNode;
 }
 
-} // namespace
+// Adds up the heap memory a tree holds, for the analysis cache budget.
+SIZE_T GetTreeAllocatedSize(const FTraceTimingNode& Node)
+{
+    SIZE_T Size = Node.Name.GetAllocatedSize() + Node.Histogram.Buckets.GetAllocatedSize() + Node.Children.GetAllocatedSize();
+    for (const FTraceTimingNode& Child : Node.Children)
+        Size += GetTreeAllocatedSize(Child);
+    return Size;
+}
 
-FTraceAnalysisResult FTraceAnalyzer::Analyze(const FString& Path, int32 DepthLimit, double MinMs, const FString& Filter)
+// Applies depth/min_ms/filter to a tree copied out of a cached analysis.
+void ApplyQuery(FTraceTimingNode& Root, int32 DepthLimit, double MinMs, const FString& Filter, const FMCPCompiledPattern& FilterPattern)
 {
-    FTraceAnalysisResult Result;
-    Result.FilePath = Path;
+    if (!Filter.IsEmpty())
+    {
+        FilterTree(Root, FilterPattern);
+        PruneByMinMs(Root, MinMs);
+        FilterTree(Root, FilterPattern);  // Remove orphan ancestors left by PruneByMinMs
+    }
+    else
+    {
+        PruneTree(Root, 0, DepthLimit, MinMs);
+    }
+}
+
+// Traces kept at once, whatever their size.
+constexpr int32 MaxCachedTraces = 8;
+
+// Unpruned analyses by full path, so repeated analyze calls with another depth, min_ms or filter skip the file.
+class FTraceAnalysisCache
+{
+public:
+    static FTraceAnalysisCache& Get()
+    {
+        static FTraceAnalysisCache Instance;
+        return Instance;
+    }
 
-    if (!IFileManager::Get().FileExists(*Path))
+    TSharedPtr<const FTraceRawAnalysis> Find(const FString& FullPath, const FFileStatData& Stat)
     {
-        Result.Error = FString::Printf(TEXT("Trace file not found: %s"), *Path);
-        return Result;
+        FScopeLock Lock(&CacheLock);
+        const TSharedPtr<const FTraceRawAnalysis>* Found = Entries.FindAndTouch(FullPath);
+        if (!Found)
+            return nullptr;
+
+        if ((*Found)->FileSize != Stat.FileSize || (*Found)->ModificationTime != Stat.ModificationTime)
+        {
+            CachedBytes -= (*Found)->AllocatedSize;
+            Entries.Remove(FullPath);
+            return nullptr;
+        }
+        return *Found;
+    }
+
+    void Add(const FString& FullPath, const TSharedRef<const FTraceRawAnalysis>& Analysis)
+    {
+        const int64 BudgetBytes = (int64)FMath::Max(0, CVarMcpTraceCacheMB.GetValueOnAnyThread()) * 1024 * 1024;
+
+        FScopeLock Lock(&CacheLock);
+        if (const TSharedPtr<const FTraceRawAnalysis>* Existing = Entries.Find(FullPath))
+        {
+            CachedBytes -= (*Existing)->AllocatedSize;
+            Entries.Remove(FullPath);
+        }
+
+        if ((int64)Analysis->AllocatedSize > BudgetBytes)
+        {
+            TrimTo(BudgetBytes, MaxCachedTraces);
+            return;
+        }
+
+        TrimTo(BudgetBytes - (int64)Analysis->AllocatedSize, MaxCachedTraces - 1);
+        Entries.Add(FullPath, Analysis);
+        CachedBytes += Analysis->AllocatedSize;
+    }
+
+    void Reset()
+    {
+        FScopeLock Lock(&CacheLock);
+        Entries.Empty(MaxCachedTraces);
+        CachedBytes = 0;
+    }
+
+private:
+    FTraceAnalysisCache()
+        : Entries(MaxCachedTraces)
+    {
+    }
+
+    // Drops least recently used traces until both limits hold. Caller holds CacheLock.
+    void TrimTo(int64 MaxBytes, int32 MaxEntries)
+    {
+        while (Entries.Num() > 0 && (CachedBytes > MaxBytes || Entries.Num() > MaxEntries))
+        {
+            CachedBytes -= Entries.RemoveLeastRecent()->AllocatedSize;
+        }
     }
 
+    FCriticalSection CacheLock;
+    TLruCache<FString, TSharedPtr<const FTraceRawAnalysis>> Entries;
+    int64 CachedBytes = 0;
+};
+
+// Reads the whole trace into unpruned GPU and CPU trees. Returns null with OutError set on failure or cancellation.
+TSharedPtr<FTraceRawAnalysis> ReadTrace(const FString& Path, const FMCPToolContext& Context, FString& OutError)
+{
+    TSharedRef<FTraceRawAnalysis> Raw = MakeShared<FTraceRawAnalysis>();
+
     ITraceServicesModule& TraceServicesModule =
         FModuleManager::LoadModuleChecked<ITraceServicesModule>(TEXT("TraceServices"));
 
     TSharedPtr<TraceServices::IAnalysisService> AnalysisService = TraceServicesModule.GetAnalysisService();
     if (!AnalysisService.IsValid())
     {
-        Result.Error = TEXT("Failed to get TraceServices analysis service");
-        return Result;
+        OutError = TEXT("Failed to get TraceServices analysis service");
+        return nullptr;
     }
 
     // Use StartAnalysis + Wait separately to handle null session gracefully
     TSharedPtr<const TraceServices::IAnalysisSession> Session = AnalysisService->StartAnalysis(*Path);
     if (!Session.IsValid())
     {
-        Result.Error = FString::Printf(TEXT("Failed to open trace file for analysis: %s"), *Path);
-        return Result;
+        OutError = FString::Printf(TEXT("Failed to open trace file for analysis: %s"), *Path);
+        return nullptr;
     }
 
-    Session->Wait();
+    // Poll instead of Wait() so a cancelled request stops reading a multi-GB trace.
+    while (!Session->IsAnalysisComplete())
+    {
+        if (Context.IsCancelled())
+        {
+            Session->Stop(true);
+            OutError = TEXT("Analysis cancelled");
+            return nullptr;
+        }
+        FPlatformProcess::Sleep(0.01f);
+    }
 
     TraceServices::FAnalysisSessionReadScope ReadScope(*Session);
     const TraceServices::IFrameProvider& FrameProvider = TraceServices::ReadFrameProvider(*Session);
@@ -227,6 +377,7 @@ FTraceAnalysisResult FTraceAnalyzer::Analyze(const FString& Path, int32 DepthLim
 
     double TraceStartTime = TNumericLimits<double>::Max();
     double TraceEndTime   = 0.0;
+    TArray<double> FrameStartTimes;
     if (FrameCount > 0)
     {
         FrameProvider.EnumerateFrames(TraceFrameType_Game, (uint64)0, FrameCount,
@@ -236,37 +387,40 @@ FTraceAnalysisResult FTraceAnalyzer::Analyze(const FString& Path, int32 DepthLim
                 if (!FMath::IsFinite(DurationMs) || DurationMs < 0.0) return;
 
                 // Stats
+                Raw->FrameTimesMs.Add((float)DurationMs);
+                Raw->FrameStats.Histogram.Add(DurationMs);
                 TotalMs += DurationMs;
                 if (DurationMs < MinFrameMs) MinFrameMs = DurationMs;
                 if (DurationMs > MaxFrameMs) MaxFrameMs = DurationMs;
                 ++ValidCount;
 
                 // Track time window for GPU/CPU enumeration
+                FrameStartTimes.Add(Frame.StartTime);
                 TraceStartTime = FMath::Min(TraceStartTime, Frame.StartTime);
                 TraceEndTime   = FMath::Max(TraceEndTime,   Frame.EndTime);
             });
 
         if (ValidCount > 0)
         {
-            Result.FrameStats.FrameCount     = ValidCount;
-            Result.FrameStats.AvgFrameTimeMs = TotalMs / (double)ValidCount;
-            Result.FrameStats.MinFrameTimeMs = MinFrameMs;
-            Result.FrameStats.MaxFrameTimeMs = MaxFrameMs;
+            Raw->FrameStats.FrameCount     = ValidCount;
+            Raw->FrameStats.AvgFrameTimeMs = TotalMs / (double)ValidCount;
+            Raw->FrameStats.MinFrameTimeMs = MinFrameMs;
+            Raw->FrameStats.MaxFrameTimeMs = MaxFrameMs;
         }
     }
 
-    // ── GPU tree ──────────────────────────────────────────────────────────────
+    // ── GPU timeline ──────────────────────────────────────────────────────────
     const TraceServices::ITimingProfilerProvider* TimingProvider =
         TraceServices::ReadTimingProfilerProvider(*Session);
 
     if (!TimingProvider)
-        return Result; // No GPU data — valid, not an error
+        return Raw; // No GPU data — valid, not an error
 
     uint32 GpuTimelineIdx = 0;
 #if UE_VERSION_OLDER_THAN(5, 7, 0)
     // Old API (5.4–5.6)
     if (!TimingProvider->GetGpuTimelineIndex(GpuTimelineIdx))
-        return Result;
+        return Raw;
 #else
     // New API (5.7+): enumerate GPU queues for per-queue timelines
     bool bFoundGpuTimeline = false;
@@ -285,55 +439,23 @@ FTraceAnalysisResult FTraceAnalyzer::Analyze(const FString& Path, int32 DepthLim
     if (!bFoundGpuTimeline)
     {
         if (!TimingProvider->GetGpuTimelineIndex(GpuTimelineIdx))
-            return Result;
+            return Raw;
     }
 #endif
 
-    // Build timer name lookup: index → name
-    TMap<uint32, FString> TimerNames;
+    // Intern timer names once; the builder only deals in NameIds
+    FTraceTimerNames TimerNames;
     TimingProvider->ReadTimers([&](const TraceServices::ITimingProfilerTimerReader& Reader)
     {
         uint32 Count = Reader.GetTimerCount();
         for (uint32 i = 0; i < Count; ++i)
         {
             const TraceServices::FTimingProfilerTimer* Timer = Reader.GetTimer(i);
-            if (Timer && Timer->Name)
-                TimerNames.Add(i, FString(Timer->Name));
+            TimerNames.SetTimer(i, Timer ? Timer->Name : nullptr);
         }
     });
 
-    // Enumerate GPU events and build tree — single pass over full timeline
-    if (ValidCount > 0)
-    {
-        TimingProvider->ReadTimeline(GpuTimelineIdx,
-            [&](const TraceServices::ITimingProfilerProvider::Timeline& GpuTimeline)
-            {
-                Result.RenderPassCount = BuildTimingTree(
-                    GpuTimeline, Result.GpuRoot, TraceStartTime, TraceEndTime, TimerNames, TimingProvider);
-            });
-    }
-
-    // Narrow to the semantically meaningful root: parent of PostProcessing
-    if (FTraceTimingNode* StartNode = FindGpuStartingPoint(Result.GpuRoot))
-    {
-        FTraceTimingNode NewRoot;
-        NewRoot.Children = MoveTemp(StartNode->Children);
-        Result.GpuRoot = MoveTemp(NewRoot);
-    }
-
-    // Prune by depth and min_ms threshold
-    if (!Filter.IsEmpty())
-    {
-        FilterTree(Result.GpuRoot, Filter);
-        PruneByMinMs(Result.GpuRoot, MinMs);
-        FilterTree(Result.GpuRoot, Filter);  // Remove orphan ancestors left by PruneByMinMs
-    }
-    else
-    {
-        PruneTree(Result.GpuRoot, 0, DepthLimit, MinMs);
-    }
-
-    // ── CPU tree (game thread) ─────────────────────────────────────────────────
+    // ── CPU timeline (game thread) ─────────────────────────────────────────────
     const TraceServices::IThreadProvider& ThreadProvider = TraceServices::ReadThreadProvider(*Session);
 
     uint32 GameThreadId = 0;
@@ -347,46 +469,155 @@ FTraceAnalysisResult FTraceAnalyzer::Analyze(const FString& Path, int32 DepthLim
         }
     });
 
-    if (bFoundGameThread && TimingProvider && ValidCount > 0)
+    uint32 CpuTimelineIdx = 0;
+    const bool bHasCpuTimeline = bFoundGameThread && TimingProvider->GetCpuThreadTimelineIndex(GameThreadId, CpuTimelineIdx);
+
+    // ── Build GPU and CPU trees ───────────────────────────────────────────────
+    // Every (timeline, chunk) pair is aggregated on its own task-graph worker, then each timeline's chunks are merged.
+    if (ValidCount > 0)
     {
-        uint32 CpuTimelineIdx = 0;
-        if (TimingProvider->GetCpuThreadTimelineIndex(GameThreadId, CpuTimelineIdx))
+        TArray<uint32> Timelines = { GpuTimelineIdx };
+        if (bHasCpuTimeline)
+            Timelines.Add(CpuTimelineIdx);
+
+        const TArray<FTimelineChunk> Chunks = MakeTimelineChunks(FrameStartTimes, TraceStartTime, TraceEndTime);
+        const int32 NumJobs = Timelines.Num() * Chunks.Num();
+
+        TArray<FTraceTimingArena> ChunkArenas;
+        ChunkArenas.SetNum(NumJobs);
+        TArray<int32> ChunkTopLevelCounts;
+        ChunkTopLevelCounts.SetNumZeroed(NumJobs);
+
+        ParallelFor(NumJobs, [&](int32 Job)
         {
-            TimingProvider->ReadTimeline(CpuTimelineIdx,
-                [&](const TraceServices::ITimingProfilerProvider::Timeline& CpuTimeline)
+            // TraceServices checks the read lock per thread.
+            TraceServices::FAnalysisSessionReadScope JobReadScope(*Session);
+            TimingProvider->ReadTimeline(Timelines[Job / Chunks.Num()],
+                [&](const TraceServices::ITimingProfilerProvider::Timeline& Timeline)
                 {
-                    Result.CpuFrameCount = BuildTimingTree(
-                        CpuTimeline, Result.CpuRoot, TraceStartTime, TraceEndTime, TimerNames, TimingProvider);
+                    ChunkTopLevelCounts[Job] = BuildTimingTree(
+                        Timeline, ChunkArenas[Job], Chunks[Job % Chunks.Num()], TraceEndTime, TimerNames, TimingProvider, Context);
                 });
+        });
+
+        for (int32 TimelineIndex = 0; TimelineIndex < Timelines.Num(); ++TimelineIndex)
+        {
+            // Chunks merge in time order, so children keep the first-seen order of a single pass.
+            const int32 FirstJob = TimelineIndex * Chunks.Num();
+            FTraceTimingArena& Merged = ChunkArenas[FirstJob];
+            int32& TopLevelCount = TimelineIndex == 0 ? Raw->RenderPassCount : Raw->CpuFrameCount;
+            TopLevelCount = ChunkTopLevelCounts[FirstJob];
+            for (int32 ChunkIndex = 1; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+            {
+                Merged.Merge(ChunkArenas[FirstJob + ChunkIndex]);
+                TopLevelCount += ChunkTopLevelCounts[FirstJob + ChunkIndex];
+            }
+
+            // Names are attached here, once per node instead of once per event.
+            Merged.ToTree(TimerNames, TimelineIndex == 0 ? Raw->GpuRoot : Raw->CpuRoot);
         }
     }
 
+    if (Context.IsCancelled())
+    {
+        OutError = TEXT("Analysis cancelled");
+        return nullptr;
+    }
+
+    // Narrow to the semantically meaningful root: parent of PostProcessing
+    if (FTraceTimingNode* StartNode = FindGpuStartingPoint(Raw->GpuRoot))
+    {
+        FTraceTimingNode NewRoot;
+        NewRoot.Children = MoveTemp(StartNode->Children);
+        Raw->GpuRoot = MoveTemp(NewRoot);
+    }
+
     // Narrow CPU tree to FEngineLoop::Tick children
-    if (FTraceTimingNode* CpuStart = FindCpuStartingPoint(Result.CpuRoot))
+    if (FTraceTimingNode* CpuStart = FindCpuStartingPoint(Raw->CpuRoot))
     {
         FTraceTimingNode NewCpuRoot;
         NewCpuRoot.Children = MoveTemp(CpuStart->Children);
-        Result.CpuRoot = MoveTemp(NewCpuRoot);
+        Raw->CpuRoot = MoveTemp(NewCpuRoot);
     }
 
-    // Prune CPU tree
-    if (!Filter.IsEmpty())
+    return Raw;
+}
+
+} // namespace
+
+FTraceAnalysisResult FTraceAnalyzer::Analyze(const FString& Path, int32 DepthLimit, double MinMs, const FString& Filter,
+    const FMCPToolContext& Context)
+{
+    FTraceAnalysisResult Result;
+    Result.FilePath = Path;
+
+    const FFileStatData Stat = IFileManager::Get().GetStatData(*Path);
+    if (!Stat.bIsValid || Stat.bIsDirectory)
     {
-        FilterTree(Result.CpuRoot, Filter);
-        PruneByMinMs(Result.CpuRoot, MinMs);
-        FilterTree(Result.CpuRoot, Filter);
+        Result.Error = FString::Printf(TEXT("Trace file not found: %s"), *Path);
+        return Result;
+    }
+
+    const FString FullPath = FPaths::ConvertRelativePathToFull(Path);
+    FTraceAnalysisCache& Cache = FTraceAnalysisCache::Get();
+
+    TSharedPtr<const FTraceRawAnalysis> Raw = Cache.Find(FullPath, Stat);
+    if (Raw.IsValid())
+    {
+        Result.bFromCache = true;
     }
     else
     {
-        PruneTree(Result.CpuRoot, 0, DepthLimit, MinMs);
+        const bool bUseSummaryFile = CVarMcpTraceSummaryFiles.GetValueOnAnyThread() != 0;
+
+        // Read outside the cache lock; two concurrent misses on the same file just read it twice.
+        TSharedPtr<FTraceRawAnalysis> Read = bUseSummaryFile ? FTraceSummaryFile::Load(FullPath) : nullptr;
+        if (Read.IsValid())
+        {
+            Result.bFromSummaryFile = true;
+        }
+        else
+        {
+            Read = ReadTrace(Path, Context, Result.Error);
+            if (!Read.IsValid())
+                return Result;
+
+            // Best effort: a read-only folder only means the next editor session reads the trace again.
+            if (bUseSummaryFile)
+                FTraceSummaryFile::Save(FullPath, *Read);
+        }
+
+        Read->FileSize         = Stat.FileSize;
+        Read->ModificationTime = Stat.ModificationTime;
+        Read->AllocatedSize    = sizeof(FTraceRawAnalysis) + Read->FrameTimesMs.GetAllocatedSize()
+            + GetTreeAllocatedSize(Read->GpuRoot) + GetTreeAllocatedSize(Read->CpuRoot);
+        Cache.Add(FullPath, Read.ToSharedRef());
+        Raw = Read;
     }
 
+    Result.FrameStats      = Raw->FrameStats;
+    Result.RenderPassCount = Raw->RenderPassCount;
+    Result.CpuFrameCount   = Raw->CpuFrameCount;
+    Result.GpuRoot         = Raw->GpuRoot;
+    Result.CpuRoot         = Raw->CpuRoot;
+
+    // Prune by depth and min_ms threshold
+    const FMCPCompiledPattern FilterPattern = FMCPSearchPatterns::Compile(Filter);
+    ApplyQuery(Result.GpuRoot, DepthLimit, MinMs, Filter, FilterPattern);
+    ApplyQuery(Result.CpuRoot, DepthLimit, MinMs, Filter, FilterPattern);
+
     return Result;
 }
 
+void FTraceAnalyzer::ResetCache()
+{
+    FTraceAnalysisCache::Get().Reset();
+}
+
 #else // !LERVIKMCP_WITH_TRACE_ANALYSIS
 
-FTraceAnalysisResult FTraceAnalyzer::Analyze(const FString& Path, int32 DepthLimit, double MinMs, const FString& Filter)
+FTraceAnalysisResult FTraceAnalyzer::Analyze(const FString& Path, int32 DepthLimit, double MinMs, const FString& Filter,
+    const FMCPToolContext& Context)
 {
     FTraceAnalysisResult Result;
     Result.FilePath = Path;
@@ -394,4 +625,8 @@ FTraceAnalysisResult FTraceAnalyzer::Analyze(const FString& Path, int32 DepthLim
     return Result;
 }
 
+void FTraceAnalyzer::ResetCache()
+{
+}
+
 #endif // LERVIKMCP_WITH_TRACE_ANALYSIS
@@ -1,5 +1,7 @@
 #pragma once
 #include "CoreMinimal.h"
+#include "MCPToolContext.h"
+#include "Tools/TraceHistogram.h"
 
 struct FTraceFrameStats
 {
@@ -7,6 +9,9 @@ struct FTraceFrameStats
     double AvgFrameTimeMs  = 0.0;
     double MinFrameTimeMs  = 0.0;
     double MaxFrameTimeMs  = 0.0;
+    FTraceDurationHistogram Histogram;
+
+    double GetPercentileMs(double Fraction) const { return Histogram.GetPercentileMs(Fraction, MinFrameTimeMs, MaxFrameTimeMs); }
 };
 
 struct FTraceTimingNode
@@ -16,9 +21,11 @@ struct FTraceTimingNode
     double  TotalMs = 0.0;
     double  MinMs   = TNumericLimits<double>::Max();
     double  MaxMs   = 0.0;
+    FTraceDurationHistogram Histogram;
     TArray<FTraceTimingNode> Children;
 
     double GetAvgMs() const { return Count > 0 ? TotalMs / Count : 0.0; }
+    double GetPercentileMs(double Fraction) const { return Histogram.GetPercentileMs(Fraction, MinMs, MaxMs); }
 };
 using FTraceGpuNode = FTraceTimingNode;
 
@@ -31,10 +38,38 @@ struct FTraceAnalysisResult
     int32            CpuFrameCount   = 0;
     FString          FilePath;
     FString          Error;
+    bool             bFromCache       = false;   // trees came from an earlier analyze of the unchanged file
+    bool             bFromSummaryFile = false;   // trees came from the .utrace.mcpsum written by an earlier analyze
 };
 
-class FTraceAnalyzer
+/** Everything read from a .utrace before depth/min_ms/filter are applied. Also what a .utrace.mcpsum file holds. */
+struct FTraceRawAnalysis
+{
+    FTraceFrameStats FrameStats;
+    TArray<float>    FrameTimesMs;   // every valid game frame, in order
+    FTraceTimingNode GpuRoot;        // narrowed like FTraceAnalysisResult::GpuRoot, not pruned
+    FTraceTimingNode CpuRoot;
+    int32            RenderPassCount = 0;
+    int32            CpuFrameCount   = 0;
+
+    // File size and modification time when the trace was read; a trace that is still being written won't match.
+    int64            FileSize = 0;
+    FDateTime        ModificationTime;
+    SIZE_T           AllocatedSize = 0;
+};
+
+class LERVIKMCP_API FTraceAnalyzer
 {
 public:
-    static FTraceAnalysisResult Analyze(const FString& Path, int32 DepthLimit = 1, double MinMs = 0.1, const FString& Filter = TEXT(""));
+    /**
+     * The unpruned trees of the last few traces are kept keyed by path, size and modification time,
+     * so re-running with another depth, min_ms or filter only redoes the pruning. They are also saved to a
+     * .utrace.mcpsum file next to the trace (see FTraceSummaryFile), so this holds across editor restarts.
+     * Context is polled while the trace is read; a cancelled analysis returns early with Error set.
+     */
+    static FTraceAnalysisResult Analyze(const FString& Path, int32 DepthLimit = 1, double MinMs = 0.1, const FString& Filter = TEXT(""),
+        const FMCPToolContext& Context = FMCPToolContext());
+
+    /** Forgets every parsed trace kept for repeated analyze calls (see mcp.trace_cache_mb). */
+    static void ResetCache();
 };
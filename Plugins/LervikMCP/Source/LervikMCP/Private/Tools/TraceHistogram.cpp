@@ -0,0 +1,111 @@
+#include "Tools/TraceHistogram.h"
+
+int32 FTraceDurationHistogram::GetBucketIndex(double DurationMs)
+{
+    if (!(DurationMs > 0.0))
+        return 0;
+    const double Position = (FMath::Log2(DurationMs) - MinOctave) * BucketsPerOctave;
+    return FMath::Clamp((int32)FMath::FloorToDouble(Position), 0, NumBuckets - 1);
+}
+
+double FTraceDurationHistogram::GetBucketLowerMs(int32 Index)
+{
+    return FMath::Pow(2.0, MinOctave + (double)Index / BucketsPerOctave);
+}
+
+void FTraceDurationHistogram::Add(double DurationMs)
+{
+    const uint16 Index = (uint16)GetBucketIndex(DurationMs);
+
+    // Most scopes land in the same few buckets, so a short scan beats a binary search here.
+    int32 Slot = 0;
+    while (Slot < Buckets.Num() && Buckets[Slot].Index < Index)
+        ++Slot;
+
+    if (Slot < Buckets.Num() && Buckets[Slot].Index == Index)
+        Buckets[Slot].Count++;
+    else
+        Buckets.Insert(FBucket { Index, 1 }, Slot);
+}
+
+void FTraceDurationHistogram::Merge(const FTraceDurationHistogram& Other)
+{
+    if (Other.Buckets.Num() == 0)
+        return;
+    if (Buckets.Num() == 0)
+    {
+        Buckets = Other.Buckets;
+        return;
+    }
+
+    TArray<FBucket, TInlineAllocator<2>> Merged;
+    Merged.Reserve(Buckets.Num() + Other.Buckets.Num());
+    int32 A = 0;
+    int32 B = 0;
+    while (A < Buckets.Num() || B < Other.Buckets.Num())
+    {
+        if (B == Other.Buckets.Num() || (A < Buckets.Num() && Buckets[A].Index < Other.Buckets[B].Index))
+        {
+            Merged.Add(Buckets[A++]);
+        }
+        else if (A == Buckets.Num() || Other.Buckets[B].Index < Buckets[A].Index)
+        {
+            Merged.Add(Other.Buckets[B++]);
+        }
+        else
+        {
+            Merged.Add(FBucket { Buckets[A].Index, Buckets[A].Count + Other.Buckets[B].Count });
+            ++A;
+            ++B;
+        }
+    }
+    Buckets = MoveTemp(Merged);
+}
+
+uint64 FTraceDurationHistogram::GetCount() const
+{
+    uint64 Count = 0;
+    for (const FBucket& Bucket : Buckets)
+        Count += Bucket.Count;
+    return Count;
+}
+
+double FTraceDurationHistogram::GetPercentileMs(double Fraction, double MinMs, double MaxMs) const
+{
+    const uint64 Total = GetCount();
+    if (Total == 0)
+        return 0.0;
+
+    const uint64 Rank = FMath::Clamp<uint64>((uint64)FMath::CeilToDouble(FMath::Clamp(Fraction, 0.0, 1.0) * Total), 1, Total);
+    uint64 Seen = 0;
+    for (const FBucket& Bucket : Buckets)
+    {
+        Seen += Bucket.Count;
+        if (Seen >= Rank)
+        {
+            const double MiddleMs = GetBucketLowerMs(Bucket.Index) * FMath::Pow(2.0, 0.5 / BucketsPerOctave);
+            return FMath::Clamp(MiddleMs, MinMs, MaxMs);
+        }
+    }
+    return MaxMs;
+}
+
+TArray<TPair<double, uint32>> FTraceDurationHistogram::GetCoarseBuckets(int32 CoarseBucketsPerOctave) const
+{
+    check(CoarseBucketsPerOctave > 0 && BucketsPerOctave % CoarseBucketsPerOctave == 0);
+    const int32 Group = BucketsPerOctave / CoarseBucketsPerOctave;
+
+    TArray<TPair<double, uint32>> Result;
+    int32 CurrentGroup = INDEX_NONE;
+    for (const FBucket& Bucket : Buckets)
+    {
+        const int32 BucketGroup = Bucket.Index / Group;
+        if (BucketGroup != CurrentGroup)
+        {
+            Result.Emplace(GetBucketLowerMs((BucketGroup + 1) * Group), 0);
+            CurrentGroup = BucketGroup;
+        }
+        Result.Last().Value += Bucket.Count;
+    }
+    return Result;
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include "CoreMinimal.h"
+
+/**
+ * Streaming histogram of durations in log-spaced buckets: BucketsPerOctave per power of two (about 9% wide)
+ * from 2^-10 ms (~1 µs) to 2^14 ms (~16 s), clamped at both ends. Only non-empty buckets are stored, so
+ * scopes that always take about the same time stay a few bytes. Merging adds bucket counts, so per-thread
+ * histograms combine exactly.
+ */
+struct LERVIKMCP_API FTraceDurationHistogram
+{
+    static constexpr int32 BucketsPerOctave = 8;
+    static constexpr int32 MinOctave = -10;
+    static constexpr int32 MaxOctave = 14;
+    static constexpr int32 NumBuckets = (MaxOctave - MinOctave) * BucketsPerOctave;
+
+    struct FBucket
+    {
+        uint16 Index = 0;
+        uint32 Count = 0;
+    };
+
+    /** Sorted by Index. */
+    TArray<FBucket, TInlineAllocator<2>> Buckets;
+
+    void Add(double DurationMs);
+    void Merge(const FTraceDurationHistogram& Other);
+    void Reset() { Buckets.Reset(); }
+
+    uint64 GetCount() const;
+
+    /** Value at Fraction (0..1) of the samples, as the geometric middle of its bucket clamped to [MinMs, MaxMs]. */
+    double GetPercentileMs(double Fraction, double MinMs, double MaxMs) const;
+
+    /**
+     * Non-empty buckets regrouped to CoarseBucketsPerOctave per power of two, as (upper bound ms, count) pairs.
+     * Meant for output; CoarseBucketsPerOctave must divide BucketsPerOctave.
+     */
+    TArray<TPair<double, uint32>> GetCoarseBuckets(int32 CoarseBucketsPerOctave) const;
+
+    static int32 GetBucketIndex(double DurationMs);
+    static double GetBucketLowerMs(int32 Index);
+};
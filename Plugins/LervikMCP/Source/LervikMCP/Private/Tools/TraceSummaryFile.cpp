@@ -0,0 +1,284 @@
+#include "Tools/TraceSummaryFile.h"
+
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/xxhash.h"
+#include "Memory/MemoryView.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace {
+
+constexpr uint32 SummaryMagic   = 0x5350434D; // "MCPS"
+constexpr uint32 SummaryVersion = 2;
+
+// Bytes hashed from each end of the trace. Hashing whole multi-GB traces would cost more than the summary saves.
+constexpr int64 HashedBytesPerEnd = 64 * 1024;
+
+// Guards against corrupt files recursing without end; real timing trees are a few dozen levels deep.
+constexpr int32 MaxTreeDepth = 1024;
+
+// NameId, Count, TotalMs, MinMs, MaxMs, NumBuckets, NumChildren.
+constexpr int64 MinNodeBytes = sizeof(int32) * 4 + sizeof(double) * 3;
+
+// Index, Count.
+constexpr int64 BucketBytes = sizeof(uint16) + sizeof(uint32);
+
+// Timer names differing only by case are different timers.
+struct FCaseSensitiveNameKeyFuncs : TDefaultMapKeyFuncs<FString, int32, false>
+{
+    static bool Matches(const FString& A, const FString& B)
+    {
+        return A.Equals(B, ESearchCase::CaseSensitive);
+    }
+
+    static uint32 GetKeyHash(const FString& Key)
+    {
+        return FCrc::StrCrc32(*Key);
+    }
+};
+
+using FNameIds = TMap<FString, int32, FDefaultSetAllocator, FCaseSensitiveNameKeyFuncs>;
+
+bool HashSource(const FString& TracePath, int64& OutSize, uint64& OutHash)
+{
+    TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*TracePath, FILEREAD_AllowWrite));
+    if (!Reader)
+        return false;
+
+    const int64 Size = Reader->TotalSize();
+    FXxHash64Builder Builder;
+    Builder.Update(&Size, sizeof(Size));
+
+    TArray<uint8> Buffer;
+    const int64 HeadBytes = FMath::Min(Size, HashedBytesPerEnd);
+    Buffer.SetNumUninitialized((int32)HeadBytes);
+    Reader->Serialize(Buffer.GetData(), HeadBytes);
+    Builder.Update(Buffer.GetData(), HeadBytes);
+
+    const int64 TailBytes = FMath::Min(Size - HeadBytes, HashedBytesPerEnd);
+    if (TailBytes > 0)
+    {
+        Reader->Seek(Size - TailBytes);
+        Reader->Serialize(Buffer.GetData(), TailBytes);
+        Builder.Update(Buffer.GetData(), TailBytes);
+    }
+
+    if (Reader->IsError())
+        return false;
+
+    OutSize = Size;
+    OutHash = Builder.Finalize().Hash;
+    return true;
+}
+
+void CollectNames(const FTraceTimingNode& Node, FNameIds& NameIds, TArray<const FString*>& Names)
+{
+    if (!NameIds.Contains(Node.Name))
+    {
+        NameIds.Add(Node.Name, Names.Num());
+        Names.Add(&Node.Name);
+    }
+    for (const FTraceTimingNode& Child : Node.Children)
+        CollectNames(Child, NameIds, Names);
+}
+
+void WriteHistogram(FArchive& Ar, const FTraceDurationHistogram& Histogram)
+{
+    int32 NumBuckets = Histogram.Buckets.Num();
+    Ar << NumBuckets;
+    for (FTraceDurationHistogram::FBucket Bucket : Histogram.Buckets)
+        Ar << Bucket.Index << Bucket.Count;
+}
+
+bool ReadHistogram(FArchive& Ar, FTraceDurationHistogram& Histogram)
+{
+    int32 NumBuckets = 0;
+    Ar << NumBuckets;
+    if (Ar.IsError() || NumBuckets < 0 || NumBuckets > FTraceDurationHistogram::NumBuckets
+        || NumBuckets > (Ar.TotalSize() - Ar.Tell()) / BucketBytes)
+        return false;
+
+    Histogram.Buckets.SetNum(NumBuckets);
+    for (int32 i = 0; i < NumBuckets; ++i)
+    {
+        FTraceDurationHistogram::FBucket& Bucket = Histogram.Buckets[i];
+        Ar << Bucket.Index << Bucket.Count;
+        // Merge and Add rely on strictly increasing indices.
+        if (Bucket.Index >= FTraceDurationHistogram::NumBuckets || (i > 0 && Bucket.Index <= Histogram.Buckets[i - 1].Index))
+            return false;
+    }
+    return !Ar.IsError();
+}
+
+void WriteNode(FArchive& Ar, const FTraceTimingNode& Node, const FNameIds& NameIds)
+{
+    int32 NameId = NameIds.FindChecked(Node.Name);
+    int32 Count = Node.Count;
+    double TotalMs = Node.TotalMs;
+    double MinMs = Node.MinMs;
+    double MaxMs = Node.MaxMs;
+    int32 NumChildren = Node.Children.Num();
+    Ar << NameId << Count << TotalMs << MinMs << MaxMs;
+    WriteHistogram(Ar, Node.Histogram);
+    Ar << NumChildren;
+
+    for (const FTraceTimingNode& Child : Node.Children)
+        WriteNode(Ar, Child, NameIds);
+}
+
+bool ReadNode(FArchive& Ar, FTraceTimingNode& Node, const TArray<FString>& Names, int32 Depth)
+{
+    int32 NameId = 0;
+    int32 NumChildren = 0;
+    Ar << NameId << Node.Count << Node.TotalMs << Node.MinMs << Node.MaxMs;
+    if (!ReadHistogram(Ar, Node.Histogram))
+        return false;
+    Ar << NumChildren;
+
+    if (Ar.IsError() || Depth > MaxTreeDepth || !Names.IsValidIndex(NameId)
+        || NumChildren < 0 || NumChildren > (Ar.TotalSize() - Ar.Tell()) / MinNodeBytes)
+        return false;
+
+    Node.Name = Names[NameId];
+    Node.Children.SetNum(NumChildren);
+    for (FTraceTimingNode& Child : Node.Children)
+    {
+        if (!ReadNode(Ar, Child, Names, Depth + 1))
+            return false;
+    }
+    return true;
+}
+
+TSharedPtr<FTraceRawAnalysis> ReadSummary(FArchive& Ar, int64 SourceSize, uint64 SourceHash)
+{
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    int64 SummarySourceSize = 0;
+    uint64 SummarySourceHash = 0;
+    Ar << Magic << Version << SummarySourceSize << SummarySourceHash;
+    if (Ar.IsError() || Magic != SummaryMagic || Version != SummaryVersion
+        || SummarySourceSize != SourceSize || SummarySourceHash != SourceHash)
+        return nullptr;
+
+    TSharedRef<FTraceRawAnalysis> Analysis = MakeShared<FTraceRawAnalysis>();
+    FTraceFrameStats& Stats = Analysis->FrameStats;
+    Ar << Stats.FrameCount << Stats.AvgFrameTimeMs << Stats.MinFrameTimeMs << Stats.MaxFrameTimeMs;
+    Ar << Analysis->RenderPassCount << Analysis->CpuFrameCount;
+    if (!ReadHistogram(Ar, Stats.Histogram))
+        return nullptr;
+
+    int32 NumFrames = 0;
+    Ar << NumFrames;
+    if (Ar.IsError() || NumFrames < 0 || NumFrames > (Ar.TotalSize() - Ar.Tell()) / (int64)sizeof(float))
+        return nullptr;
+    Analysis->FrameTimesMs.SetNumUninitialized(NumFrames);
+    Ar.Serialize(Analysis->FrameTimesMs.GetData(), NumFrames * sizeof(float));
+
+    int32 NumNames = 0;
+    Ar << NumNames;
+    if (Ar.IsError() || NumNames < 0 || NumNames > Ar.TotalSize() - Ar.Tell())
+        return nullptr;
+    TArray<FString> Names;
+    Names.SetNum(NumNames);
+    for (FString& Name : Names)
+        Ar << Name;
+
+    if (!ReadNode(Ar, Analysis->GpuRoot, Names, 0) || !ReadNode(Ar, Analysis->CpuRoot, Names, 0) || Ar.IsError())
+        return nullptr;
+
+    return Analysis;
+}
+
+} // namespace
+
+FString FTraceSummaryFile::GetSummaryPath(const FString& TracePath)
+{
+    return TracePath + TEXT(".mcpsum");
+}
+
+TSharedPtr<FTraceRawAnalysis> FTraceSummaryFile::Load(const FString& TracePath)
+{
+    const FString SummaryPath = GetSummaryPath(TracePath);
+    if (!IFileManager::Get().FileExists(*SummaryPath))
+        return nullptr;
+
+    int64 SourceSize = 0;
+    uint64 SourceHash = 0;
+    if (!HashSource(TracePath, SourceSize, SourceHash))
+        return nullptr;
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    FOpenMappedResult Mapped = PlatformFile.OpenMappedEx(*SummaryPath);
+    if (Mapped.HasValue())
+    {
+        TUniquePtr<IMappedFileHandle> Handle = Mapped.StealValue();
+        TUniquePtr<IMappedFileRegion> Region(Handle->MapRegion());
+        if (Region)
+        {
+            FMemoryReaderView Reader(FMemoryView(Region->GetMappedPtr(), (uint64)Region->GetMappedSize()));
+            return ReadSummary(Reader, SourceSize, SourceHash);
+        }
+    }
+
+    // Platforms without file mapping read the (small) summary into memory instead.
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *SummaryPath, FILEREAD_Silent))
+        return nullptr;
+    FMemoryReader Reader(Bytes);
+    return ReadSummary(Reader, SourceSize, SourceHash);
+}
+
+bool FTraceSummaryFile::Save(const FString& TracePath, const FTraceRawAnalysis& Analysis)
+{
+    int64 SourceSize = 0;
+    uint64 SourceHash = 0;
+    if (!HashSource(TracePath, SourceSize, SourceHash))
+        return false;
+
+    FNameIds NameIds;
+    TArray<const FString*> Names;
+    CollectNames(Analysis.GpuRoot, NameIds, Names);
+    CollectNames(Analysis.CpuRoot, NameIds, Names);
+
+    TArray<uint8> Bytes;
+    FMemoryWriter Ar(Bytes);
+
+    uint32 Magic = SummaryMagic;
+    uint32 Version = SummaryVersion;
+    Ar << Magic << Version << SourceSize << SourceHash;
+
+    FTraceFrameStats Stats = Analysis.FrameStats;
+    int32 RenderPassCount = Analysis.RenderPassCount;
+    int32 CpuFrameCount = Analysis.CpuFrameCount;
+    Ar << Stats.FrameCount << Stats.AvgFrameTimeMs << Stats.MinFrameTimeMs << Stats.MaxFrameTimeMs;
+    Ar << RenderPassCount << CpuFrameCount;
+    WriteHistogram(Ar, Stats.Histogram);
+
+    int32 NumFrames = Analysis.FrameTimesMs.Num();
+    Ar << NumFrames;
+    Ar.Serialize(const_cast<float*>(Analysis.FrameTimesMs.GetData()), NumFrames * sizeof(float));
+
+    int32 NumNames = Names.Num();
+    Ar << NumNames;
+    for (const FString* Name : Names)
+        Ar << const_cast<FString&>(*Name);
+
+    WriteNode(Ar, Analysis.GpuRoot, NameIds);
+    WriteNode(Ar, Analysis.CpuRoot, NameIds);
+
+    const FString SummaryPath = GetSummaryPath(TracePath);
+    const FString TempPath = FString::Printf(TEXT("%s.%s.tmp"), *SummaryPath, *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+    if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath))
+        return false;
+
+    if (!IFileManager::Get().Move(*SummaryPath, *TempPath, true, true, false, true))
+    {
+        IFileManager::Get().Delete(*TempPath, false, false, true);
+        return false;
+    }
+    return true;
+}
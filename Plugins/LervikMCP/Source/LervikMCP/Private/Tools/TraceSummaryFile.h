@@ -0,0 +1,22 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Tools/TraceAnalyzer.h"
+
+/**
+ * Compact binary summary of an analyzed .utrace, written next to it as <trace>.mcpsum.
+ * Holds the per-frame durations and the unpruned GPU/CPU trees with timer names stored once,
+ * so a later analyze of the same trace (even after an editor restart) skips TraceServices.
+ * The file carries a format version and a hash of the trace's size, head and tail; a mismatch on
+ * either means the trace changed or the format moved on, and the summary is ignored.
+ */
+class FTraceSummaryFile
+{
+public:
+    static FString GetSummaryPath(const FString& TracePath);
+
+    /** Reads (memory-mapped where the platform allows) the summary of TracePath. Null if missing, stale or corrupt. */
+    static TSharedPtr<FTraceRawAnalysis> Load(const FString& TracePath);
+
+    /** Writes the summary through a temp file and a rename, so concurrent readers never see half a file. */
+    static bool Save(const FString& TracePath, const FTraceRawAnalysis& Analysis);
+};
@@ -0,0 +1,140 @@
+#include "Tools/TraceTimingArena.h"
+
+void FTraceTimerNames::SetTimer(uint32 TimerIndex, const TCHAR* Name)
+{
+    if (TimerNameIds.Num() <= (int32)TimerIndex)
+    {
+        const int32 OldNum = TimerNameIds.Num();
+        TimerNameIds.SetNumUninitialized(TimerIndex + 1);
+        for (int32 i = OldNum; i < TimerNameIds.Num(); ++i)
+            TimerNameIds[i] = UnnamedTimerBit | (uint32)i;
+    }
+
+    if (!Name)
+        return;
+
+    FString NameString(Name);
+    if (const uint32* Existing = NameIdsByName.Find(NameString))
+    {
+        TimerNameIds[TimerIndex] = *Existing;
+        return;
+    }
+
+    const uint32 NameId = Names.Num();
+    NameIdsByName.Add(NameString, NameId);
+    Names.Add(MoveTemp(NameString));
+    TimerNameIds[TimerIndex] = NameId;
+}
+
+uint32 FTraceTimerNames::GetNameId(uint32 TimerIndex) const
+{
+    return TimerNameIds.IsValidIndex((int32)TimerIndex) ? TimerNameIds[TimerIndex] : (UnnamedTimerBit | TimerIndex);
+}
+
+FString FTraceTimerNames::GetName(uint32 NameId) const
+{
+    if (NameId & UnnamedTimerBit)
+        return FString::Printf(TEXT("Timer_%u"), NameId & ~UnnamedTimerBit);
+    return Names[NameId];
+}
+
+FTraceTimingArena::FTraceTimingArena()
+{
+    // The virtual root.
+    NameIds.Add(0);
+    Occurrences.Add(0);
+    Counts.Add(0);
+    TotalMs.Add(0.0);
+    MinMs.Add(TNumericLimits<double>::Max());
+    MaxMs.Add(0.0);
+    Histograms.AddDefaulted();
+    FirstChild.Add(INDEX_NONE);
+    LastChild.Add(INDEX_NONE);
+    NextSibling.Add(INDEX_NONE);
+}
+
+int32 FTraceTimingArena::FindOrAddChild(int32 Parent, uint32 NameId, uint32 Occurrence)
+{
+    const FChildKey Key { Parent, NameId, Occurrence };
+    const uint32 KeyHash = GetTypeHash(Key);
+    if (const int32* Found = ChildIndex.FindByHash(KeyHash, Key))
+        return *Found;
+
+    const int32 Node = NameIds.Add(NameId);
+    Occurrences.Add(Occurrence);
+    Counts.Add(0);
+    TotalMs.Add(0.0);
+    MinMs.Add(TNumericLimits<double>::Max());
+    MaxMs.Add(0.0);
+    Histograms.AddDefaulted();
+    FirstChild.Add(INDEX_NONE);
+    LastChild.Add(INDEX_NONE);
+    NextSibling.Add(INDEX_NONE);
+
+    if (LastChild[Parent] == INDEX_NONE)
+        FirstChild[Parent] = Node;
+    else
+        NextSibling[LastChild[Parent]] = Node;
+    LastChild[Parent] = Node;
+
+    ChildIndex.AddByHash(KeyHash, Key, Node);
+    return Node;
+}
+
+void FTraceTimingArena::AddSample(int32 Node, double DurationMs)
+{
+    Counts[Node]++;
+    TotalMs[Node] += DurationMs;
+    MinMs[Node] = FMath::Min(MinMs[Node], DurationMs);
+    MaxMs[Node] = FMath::Max(MaxMs[Node], DurationMs);
+    Histograms[Node].Add(DurationMs);
+}
+
+void FTraceTimingArena::Merge(const FTraceTimingArena& Other)
+{
+    MergeChildren(Other, RootIndex, RootIndex);
+}
+
+void FTraceTimingArena::MergeChildren(const FTraceTimingArena& Other, int32 OtherParent, int32 Parent)
+{
+    for (int32 OtherChild = Other.FirstChild[OtherParent]; OtherChild != INDEX_NONE; OtherChild = Other.NextSibling[OtherChild])
+    {
+        const int32 Child = FindOrAddChild(Parent, Other.NameIds[OtherChild], Other.Occurrences[OtherChild]);
+        Counts[Child]  += Other.Counts[OtherChild];
+        TotalMs[Child] += Other.TotalMs[OtherChild];
+        MinMs[Child]    = FMath::Min(MinMs[Child], Other.MinMs[OtherChild]);
+        MaxMs[Child]    = FMath::Max(MaxMs[Child], Other.MaxMs[OtherChild]);
+        Histograms[Child].Merge(Other.Histograms[OtherChild]);
+        MergeChildren(Other, OtherChild, Child);
+    }
+}
+
+void FTraceTimingArena::ToTree(const FTraceTimerNames& TimerNames, FTraceTimingNode& OutRoot) const
+{
+    OutRoot = FTraceTimingNode();
+    NodeToTree(RootIndex, TimerNames, OutRoot);
+}
+
+void FTraceTimingArena::NodeToTree(int32 Node, const FTraceTimerNames& TimerNames, FTraceTimingNode& Out) const
+{
+    if (Node != RootIndex)
+    {
+        Out.Name = Occurrences[Node] == 0
+            ? TimerNames.GetName(NameIds[Node])
+            : FString::Printf(TEXT("%s_%u"), *TimerNames.GetName(NameIds[Node]), Occurrences[Node]);
+    }
+    Out.Count   = Counts[Node];
+    Out.TotalMs = TotalMs[Node];
+    Out.MinMs   = MinMs[Node];
+    Out.MaxMs   = MaxMs[Node];
+    Out.Histogram = Histograms[Node];
+
+    int32 NumChildren = 0;
+    for (int32 Child = FirstChild[Node]; Child != INDEX_NONE; Child = NextSibling[Child])
+        ++NumChildren;
+
+    Out.Children.SetNum(NumChildren);
+    int32 ChildSlot = 0;
+    for (int32 Child = FirstChild[Node]; Child != INDEX_NONE; Child = NextSibling[Child])
+        NodeToTree(Child, TimerNames, Out.Children[ChildSlot++]);
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Tools/TraceAnalyzer.h"
+
+/**
+ * Timer names interned once per trace. Timers sharing a name (compared like FString ==) share a NameId,
+ * so they fold into one node just as when nodes were matched by name.
+ */
+class LERVIKMCP_API FTraceTimerNames
+{
+public:
+    /** NameIds with this bit set are a timer index that had no name; it is written as Timer_<index>. */
+    static constexpr uint32 UnnamedTimerBit = 0x80000000u;
+
+    void SetTimer(uint32 TimerIndex, const TCHAR* Name);
+    uint32 GetNameId(uint32 TimerIndex) const;
+    FString GetName(uint32 NameId) const;
+
+private:
+    TArray<uint32> TimerNameIds;
+    TArray<FString> Names;
+    TMap<FString, uint32> NameIdsByName;
+};
+
+/**
+ * Timing tree under construction, as index-linked columns in flat arrays. Nodes are keyed by
+ * (parent, NameId, occurrence) through one hash map, where occurrence N is the N-th scope of that name under
+ * the parent within a top-level scope (written Name_N). Names are only resolved in ToTree.
+ * Node indices stay valid as the arena grows. Not thread-safe; build one per thread and Merge.
+ */
+class LERVIKMCP_API FTraceTimingArena
+{
+public:
+    static constexpr int32 RootIndex = 0;
+
+    FTraceTimingArena();
+
+    int32 FindOrAddChild(int32 Parent, uint32 NameId, uint32 Occurrence);
+    void AddSample(int32 Node, double DurationMs);
+
+    /** Adds Other's nodes and samples under the matching nodes here; children new to this arena go last. */
+    void Merge(const FTraceTimingArena& Other);
+
+    /** Builds the named tree (OutRoot is the virtual root). Children keep the order they were first added in. */
+    void ToTree(const FTraceTimerNames& TimerNames, FTraceTimingNode& OutRoot) const;
+
+    int32 Num() const { return NameIds.Num(); }
+
+private:
+    struct FChildKey
+    {
+        int32  Parent;
+        uint32 NameId;
+        uint32 Occurrence;
+
+        bool operator==(const FChildKey& Other) const
+        {
+            return Parent == Other.Parent && NameId == Other.NameId && Occurrence == Other.Occurrence;
+        }
+
+        friend uint32 GetTypeHash(const FChildKey& Key)
+        {
+            return HashCombineFast(HashCombineFast(::GetTypeHash(Key.Parent), ::GetTypeHash(Key.NameId)), ::GetTypeHash(Key.Occurrence));
+        }
+    };
+
+    void MergeChildren(const FTraceTimingArena& Other, int32 OtherParent, int32 Parent);
+    void NodeToTree(int32 Node, const FTraceTimerNames& TimerNames, FTraceTimingNode& Out) const;
+
+    // Per-node columns.
+    TArray<uint32> NameIds;
+    TArray<uint32> Occurrences;
+    TArray<int32>  Counts;
+    TArray<double> TotalMs;
+    TArray<double> MinMs;
+    TArray<double> MaxMs;
+    TArray<FTraceDurationHistogram> Histograms;
+    TArray<int32>  FirstChild;
+    TArray<int32>  LastChild;
+    TArray<int32>  NextSibling;
+
+    TMap<FChildKey, int32> ChildIndex;
+};
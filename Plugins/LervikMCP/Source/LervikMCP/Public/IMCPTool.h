@@ -2,6 +2,8 @@
 
 #include "Features/IModularFeature.h"
 #include "MCPTypes.h"
+#include "MCPToolContext.h"
+#include "Async/Future.h"
 
 class LERVIKMCP_API IMCPTool : public IModularFeature
 {
@@ -12,4 +14,11 @@ public:
     virtual ~IMCPTool();
     virtual FMCPToolInfo GetToolInfo() const = 0;
     virtual FMCPToolResult Execute(const TSharedPtr<FJsonObject>& Params) = 0;
+
+    /**
+     * Non-blocking entry point used by the server. The default runs Execute() on the calling thread.
+     * Tools that hop to the game thread override this so the calling worker isn't parked while they wait.
+     * Context reports progress back to the client of this call.
+     */
+    virtual TFuture<FMCPToolResult> ExecuteAsync(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context);
 };
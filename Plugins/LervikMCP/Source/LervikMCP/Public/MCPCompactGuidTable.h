@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * Append-only GUID <-> small index table behind the compact node IDs in tool responses.
+ * Index -> GUID lookups are lock-free. GUID -> index lookups take a read lock on one of 16 shards;
+ * only the first sighting of a GUID takes that shard's write lock.
+ */
+class LERVIKMCP_API FMCPCompactGuidTable
+{
+public:
+    /** Longest string EncodeIndex writes: 4 index bytes -> 6 base64url characters. */
+    static constexpr int32 MaxCompactLen = 6;
+
+    FMCPCompactGuidTable();
+    ~FMCPCompactGuidTable();
+
+    FMCPCompactGuidTable(const FMCPCompactGuidTable&) = delete;
+    FMCPCompactGuidTable& operator=(const FMCPCompactGuidTable&) = delete;
+
+    /** Index of Guid, assigning the next free one on first sight. INDEX_NONE once the table is full. */
+    int32 FindOrAdd(const FGuid& Guid);
+
+    /** GUID stored at Index, or an invalid FGuid if none. Lock-free. */
+    FGuid Get(int32 Index) const;
+
+    int32 Num() const;
+
+    /** Forgets every GUID. Compact IDs handed out before are no longer resolvable. */
+    void Reset();
+
+    /** Compact ID for Guid; falls back to the 32-digit GUID if the table is full. */
+    FString ToCompact(const FGuid& Guid);
+
+    /** Accepts compact IDs and 32-digit GUIDs. Returns an invalid FGuid for anything unknown. */
+    FGuid FromCompact(FStringView Compact) const;
+
+    /**
+     * Writes Index as unpadded base64url of its minimal big-endian bytes into OutChars, which must hold
+     * MaxCompactLen characters. Returns the number written; no terminator, no allocation.
+     */
+    static int32 EncodeIndex(int32 Index, TCHAR* OutChars);
+
+    /** Inverse of EncodeIndex. Also accepts the standard base64 alphabet ('+', '/') used by older IDs. */
+    static bool DecodeIndex(FStringView Compact, int32& OutIndex);
+
+private:
+    static constexpr int32 NumShards = 16;
+    static constexpr int32 ChunkBits = 12;
+    static constexpr int32 ChunkSize = 1 << ChunkBits;
+    static constexpr int32 MaxChunks = 1024;
+
+    struct FSlot
+    {
+        FGuid Guid;
+        /** Set after Guid is written; readers that see it set see the whole GUID. */
+        TAtomic<bool> bReady { false };
+    };
+
+    struct alignas(PLATFORM_CACHE_LINE_SIZE) FShard
+    {
+        FRWLock Lock;
+        TMap<FGuid, int32> Indices;
+    };
+
+    FSlot* GetOrCreateChunk(int32 ChunkIndex);
+
+    FShard Shards[NumShards];
+    /** Chunks are allocated on demand and only freed by the destructor, so lock-free readers never see one go away. */
+    TAtomic<FSlot*> Chunks[MaxChunks];
+    TAtomic<int32> NextIndex { 0 };
+};
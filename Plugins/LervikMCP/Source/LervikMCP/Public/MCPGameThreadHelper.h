@@ -1,9 +1,11 @@
 #pragma once
 
 #include "MCPTypes.h"
-#include "Async/Async.h"
-#include "HAL/PlatformProcess.h"
+#include "MCPToolContext.h"
+#include "MCPGameThreadQueue.h"
+#include "MCPSession.h"
 
+/** Blocks until Func has run on the game thread. Runs inline when already on the game thread. */
 template<typename TFunc>
 FMCPToolResult ExecuteOnGameThread(TFunc&& Func)
 {
@@ -12,16 +14,49 @@ FMCPToolResult ExecuteOnGameThread(TFunc&& Func)
         return Func();
     }
 
-    FMCPToolResult Result;
-    FEvent* DoneEvent = FPlatformProcess::GetSynchEventFromPool(true);
+    // We block until the result is ready, so Func can safely be captured by reference.
+    return FMCPGameThreadQueue::Get().Submit([&Func, Session = FMCPSessionScope::GetCurrent()]() -> FMCPToolResult
+    {
+        FMCPSessionScope SessionScope(Session);
+        return Func();
+    }).Get();
+}
+
+/**
+ * Queues Func on the game thread and returns immediately. Runs inline when already on the game thread.
+ * Func is copied or moved into the queue, so it must not capture locals by reference.
+ * The caller's FMCPSessionScope is carried over, so compact IDs resolve in the same session.
+ */
+template<typename TFunc>
+TFuture<FMCPToolResult> ExecuteOnGameThreadAsync(TFunc&& Func)
+{
+    if (IsInGameThread())
+    {
+        return MakeFulfilledPromise<FMCPToolResult>(Func()).GetFuture();
+    }
 
-    AsyncTask(ENamedThreads::GameThread, [&Result, &Func, DoneEvent]()
+    return FMCPGameThreadQueue::Get().Submit([Session = FMCPSessionScope::GetCurrent(), Func = Forward<TFunc>(Func)]() mutable -> FMCPToolResult
     {
-        Result = Func();
-        DoneEvent->Trigger();
+        FMCPSessionScope SessionScope(Session);
+        return Func();
     });
+}
 
-    DoneEvent->Wait();
-    FPlatformProcess::ReturnSynchEventToPool(DoneEvent);
-    return Result;
+/**
+ * As above, but skips Func if the call was cancelled while it waited for the game thread,
+ * and runs it in the call's session.
+ */
+template<typename TFunc>
+TFuture<FMCPToolResult> ExecuteOnGameThreadAsync(const FMCPToolContext& Context, TFunc&& Func)
+{
+    return ExecuteOnGameThreadAsync([Context, Func = Forward<TFunc>(Func)]() mutable -> FMCPToolResult
+    {
+        if (Context.IsCancelled())
+        {
+            return FMCPToolResult::Cancelled();
+        }
+        FMCPSessionStatePtr Session = Context.GetSession();
+        FMCPSessionScope SessionScope(Session.IsValid() ? MoveTemp(Session) : FMCPSessionScope::GetCurrent());
+        return Func();
+    });
 }
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "Templates/Function.h"
+#include <type_traits>
+
+/**
+ * Game-thread work queue drained once per frame by a core ticker.
+ * Each frame runs queued work until mcp.gamethread_budget_ms is spent (always at least one item),
+ * so a burst of MCP requests is spread over several frames instead of hitching one.
+ * Falls back to a task-graph game-thread task while the ticker isn't registered.
+ */
+class LERVIKMCP_API FMCPGameThreadQueue
+{
+public:
+    static FMCPGameThreadQueue& Get();
+
+    /** Registers the per-frame ticker. Game thread only. */
+    void Startup();
+
+    /** Removes the ticker and runs whatever is still queued. Game thread only. */
+    void Shutdown();
+
+    bool IsRunning() const;
+
+    /** Queues Work to run on the game thread. Safe to call from any thread. */
+    void Enqueue(TUniqueFunction<void()>&& Work);
+
+    /** Queues Func to run on the game thread and returns a future for its result. */
+    template<typename TFunc>
+    auto Submit(TFunc&& Func) -> TFuture<decltype(Func())>
+    {
+        using ResultType = decltype(Func());
+        TPromise<ResultType> Promise;
+        TFuture<ResultType> Future = Promise.GetFuture();
+        Enqueue([Promise = MoveTemp(Promise), Func = Forward<TFunc>(Func)]() mutable
+        {
+            if constexpr (std::is_void_v<ResultType>)
+            {
+                Func();
+                Promise.SetValue();
+            }
+            else
+            {
+                Promise.SetValue(Func());
+            }
+        });
+        return Future;
+    }
+
+    /**
+     * Runs queued work on the game thread until BudgetSeconds is spent.
+     * Always runs at least one item if any are queued. Returns the number of items run.
+     */
+    int32 Pump(double BudgetSeconds);
+
+    /** Runs everything currently queued, ignoring the budget. */
+    int32 PumpAll();
+
+    /** Number of work items queued but not yet run. */
+    int32 GetPendingCount() const;
+
+private:
+    bool Tick(float DeltaTime);
+
+    TQueue<TUniqueFunction<void()>, EQueueMode::Mpsc> Queue;
+    TAtomic<int32> PendingCount{0};
+    TAtomic<bool> bRunning{false};
+    FTSTicker::FDelegateHandle TickerHandle;
+};
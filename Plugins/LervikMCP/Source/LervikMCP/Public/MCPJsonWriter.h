@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+/**
+ * Condensed JSON writer that appends UTF-8 straight into a byte buffer, which can be handed to
+ * FHttpServerResponse without another conversion. Commas between values are inserted automatically.
+ *
+ *     FMCPJsonWriter Writer;
+ *     Writer.BeginObject();
+ *     Writer.WriteKey("name");
+ *     Writer.WriteString(Name);
+ *     Writer.EndObject();
+ *     TArray<uint8> Utf8 = Writer.Take();
+ */
+class LERVIKMCP_API FMCPJsonWriter
+{
+public:
+    FMCPJsonWriter() = default;
+    explicit FMCPJsonWriter(int32 ReserveBytes);
+
+    void BeginObject();
+    void EndObject();
+    void BeginArray();
+    void EndArray();
+
+    /** Object key. The next write is its value. */
+    void WriteKey(FAnsiStringView Key);
+    void WriteKey(FStringView Key);
+
+    void WriteString(FStringView Value);
+    void WriteString(FAnsiStringView Value);
+
+    /** String value from UTF-8 bytes, escaped without converting through TCHAR. */
+    void WriteUtf8String(TConstArrayView<uint8> Utf8);
+
+    /** Integral doubles are written without a fraction, matching how JSON-RPC ids round-trip. */
+    void WriteNumber(double Value);
+    void WriteInteger(int64 Value);
+    /** Fixed-point number with the given decimals, as FMCPJsonHelpers::RoundedJsonNumber prints it. */
+    void WriteFixed(double Value, int32 Decimals = 2);
+    void WriteBool(bool bValue);
+    void WriteNull();
+
+    /** Already-serialized JSON value, copied as is. Empty writes null. */
+    void WriteRawValue(TConstArrayView<uint8> Utf8Json);
+
+    /** DOM values, for callers that already have an FJsonObject. Invalid pointers write null. */
+    void WriteValue(const TSharedPtr<FJsonValue>& Value);
+    void WriteObject(const TSharedPtr<FJsonObject>& Object);
+
+    const TArray<uint8>& GetBuffer() const { return Buffer; }
+    TArray<uint8> Take();
+
+private:
+    /** Emits the separating comma, if any, before a value or key. */
+    void BeginValue();
+    void AppendAnsi(FAnsiStringView Text);
+    void AppendEscaped(FStringView Value);
+    void AppendEscaped(TConstArrayView<uint8> Utf8);
+
+    TArray<uint8> Buffer;
+
+    /** One entry per open object/array: true once it holds at least one element. */
+    TArray<bool, TInlineAllocator<16>> ScopeHasElements;
+    bool bAfterKey = false;
+};
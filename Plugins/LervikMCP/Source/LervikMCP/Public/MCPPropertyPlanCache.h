@@ -0,0 +1,118 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "UObject/WeakObjectPtr.h"
+
+class FProperty;
+class UClass;
+class UObject;
+struct FPropertyChangedEvent;
+class FTransactionObjectEvent;
+
+/** One property UObjectToJson writes, with its JSON key built once. */
+struct FMCPPropertyPlanEntry
+{
+    FProperty* Property = nullptr;
+    FString JsonKey;
+};
+
+/**
+ * Every property of a class in TFieldIterator order, plus the entries matching each filter seen so far.
+ * Game thread only.
+ */
+class LERVIKMCP_API FMCPPropertyPlan
+{
+public:
+    explicit FMCPPropertyPlan(const UClass* Class);
+
+    using FEntryList = TArray<const FMCPPropertyPlanEntry*>;
+
+    /**
+     * Entries whose name matches Filter; all entries for an empty filter. Matched once per filter.
+     * Shared rather than a reference, so a nested UObjectToJson with another filter can't pull the list
+     * out from under a caller that is still iterating it.
+     */
+    TSharedRef<const FEntryList> GetEntries(const FString& Filter);
+
+    /** False once Class has been relinked (e.g. a Blueprint recompiled in place), so the FProperty pointers are stale. */
+    bool IsValidFor(const UClass* Class) const;
+
+    int32 Num() const { return Entries.Num(); }
+
+private:
+    /** Filters beyond this are matched per call instead of cached; keeps odd one-off filters from piling up. */
+    static constexpr int32 MaxCachedFilters = 32;
+
+    TArray<FMCPPropertyPlanEntry> Entries;
+    TSharedRef<FEntryList> AllEntries = MakeShared<FEntryList>();
+    TMap<FString, TSharedRef<const FEntryList>> FilteredEntries;
+
+    const FProperty* PropertyLinkStamp = nullptr;
+    int32 PropertiesSizeStamp = 0;
+};
+
+/**
+ * Per-class property plans and per-object JSON snapshots behind FMCPJsonHelpers::UObjectToJson, so
+ * inspecting the same class or object again skips the reflection walk, the filter match and the
+ * archetype comparison. Snapshots are dropped when the editor reports the object changed (property edit,
+ * Modify(), undo/redo) and everything is dropped on hot reload or reinstancing. Objects in a game world
+ * are never snapshotted. Game thread only.
+ */
+class LERVIKMCP_API FMCPPropertyPlanCache
+{
+public:
+    static FMCPPropertyPlanCache& Get();
+
+    TSharedRef<FMCPPropertyPlan> GetPlan(const UClass* Class);
+
+    /** Deep copy of the cached UObjectToJson result for these arguments in the current session, or null. */
+    TSharedPtr<FJsonObject> FindSnapshot(const UObject* Obj, const FString& Filter, bool bSkipDefaults);
+    void AddSnapshot(const UObject* Obj, const FString& Filter, bool bSkipDefaults, const TSharedRef<FJsonObject>& Json);
+
+    /** Drops the snapshots of Obj and of every object inside it, e.g. an actor's components. */
+    void InvalidateObject(const UObject* Obj);
+    void Reset();
+
+    int32 NumPlans() const { return Plans.Num(); }
+    int32 NumSnapshots() const;
+
+    void Shutdown();
+
+private:
+    struct FSnapshot
+    {
+        FString Filter;
+        bool bSkipDefaults = false;
+        /** Compact GUIDs in the JSON belong to this session. */
+        FGuid SessionId;
+        TSharedPtr<const FJsonObject> Json;
+    };
+
+    /** Crossing these bounds drops the whole map; classes and objects that went away are cleaned up that way too. */
+    static constexpr int32 MaxPlans = 2048;
+    static constexpr int32 MaxSnapshotObjects = 512;
+    /** Distinct filter/skip_defaults/session combinations kept per object; the oldest goes first. */
+    static constexpr int32 MaxSnapshotsPerObject = 4;
+
+    bool CanSnapshot(const UObject* Obj) const;
+    void Subscribe();
+
+#if WITH_EDITOR
+    void HandleObjectPropertyChanged(UObject* Obj, FPropertyChangedEvent& Event);
+    void HandleObjectModified(UObject* Obj);
+    void HandleObjectTransacted(UObject* Obj, const FTransactionObjectEvent& Event);
+#endif
+
+    TMap<TWeakObjectPtr<const UClass>, TSharedPtr<FMCPPropertyPlan>> Plans;
+    TMap<TWeakObjectPtr<const UObject>, TArray<FSnapshot, TInlineAllocator<1>>> Snapshots;
+
+    bool bSubscribed = false;
+    FDelegateHandle ReloadCompleteHandle;
+#if WITH_EDITOR
+    FDelegateHandle ObjectsReplacedHandle;
+    FDelegateHandle PropertyChangedHandle;
+    FDelegateHandle ObjectModifiedHandle;
+    FDelegateHandle ObjectTransactedHandle;
+#endif
+};
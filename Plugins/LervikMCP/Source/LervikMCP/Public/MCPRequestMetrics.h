@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Lock-free counters for POST /mcp traffic, reported by MCP.Status.
+ * Parse time covers turning the raw body into FMCPRequest entries.
+ */
+class LERVIKMCP_API FMCPRequestMetrics
+{
+public:
+    void RecordParse(int32 BodyBytes, double ParseSeconds);
+
+    int64 GetRequestCount() const;
+    int64 GetBodyBytes() const;
+    double GetAverageParseMs() const;
+    double GetMaxParseMs() const;
+
+private:
+    TAtomic<int64> RequestCount{0};
+    TAtomic<int64> TotalBodyBytes{0};
+    TAtomic<int64> TotalParseMicros{0};
+    TAtomic<int64> MaxParseMicros{0};
+};
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCPTypes.h"
+#include "MCPToolContext.h"
+#include "Async/Future.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+/**
+ * One list result. Tools collect a cheap handle per match (asset data, weak object pointers, ...) and
+ * WriteItem turns one handle into JSON, so only the items on a page that is actually returned get serialized.
+ */
+struct LERVIKMCP_API FMCPResultList
+{
+    /** Fields copied into every page. May be null. */
+    TSharedPtr<FJsonObject> Envelope;
+    FString ArrayField;
+
+    int32 Num = 0;
+
+    /** Set when matching stopped at FMCPResultPages::MaxItems; pages then report "truncated": true. */
+    bool bTruncated = false;
+
+    /** Writes item Index (0 <= Index < Num). Null skips an item that no longer exists, e.g. a deleted actor. */
+    TFunction<TSharedPtr<FJsonValue>(int32 Index)> WriteItem;
+
+    /** Later pages call WriteItem on the game thread. Clear it when the handles are plain values. */
+    bool bWriteOnGameThread = true;
+
+    /** List over Handles, written one at a time by WriteItem(const THandle&). */
+    template<typename THandle, typename TWriter>
+    static FMCPResultList FromHandles(const FString& ArrayField, TArray<THandle>&& Handles, TWriter&& WriteItem)
+    {
+        FMCPResultList List;
+        List.ArrayField = ArrayField;
+        List.Num = Handles.Num();
+        List.WriteItem = [Handles = MoveTemp(Handles), WriteItem = Forward<TWriter>(WriteItem)](int32 Index) -> TSharedPtr<FJsonValue>
+        {
+            return WriteItem(Handles[Index]);
+        };
+        return List;
+    }
+};
+
+/**
+ * Short-lived result snapshots for cursor pagination. A list tool hands over its FMCPResultList; the first
+ * page is written and returned, and the list is kept under an opaque cursor. Later pages are written from
+ * the snapshot without re-running the query. A cursor is only served to the session and tool it was issued
+ * to. Snapshots expire after mcp.cursor_ttl_seconds.
+ */
+class LERVIKMCP_API FMCPResultPages
+{
+public:
+    /** Upper bound on handles a tool should collect for one snapshot. */
+    static constexpr int32 MaxItems = 10000;
+
+    static FMCPResultPages& Get();
+
+    /**
+     * Writes the first page on the calling thread: Envelope's fields plus {ArrayField: [...], "count", "total"},
+     * "truncated" when set, and "next_cursor" when more items remain.
+     */
+    FMCPToolResult MakeFirstPage(const FMCPToolContext& Context, const FString& Tool, FMCPResultList&& List, int32 PageSize);
+
+    /**
+     * Returns true if Params carries a "cursor". OutResult then resolves to the page it points at, or to an
+     * error if the cursor is unknown, expired or belongs to another session or tool. Serving the same cursor
+     * again returns the same page.
+     */
+    bool TryServeCursor(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context, const FString& Tool,
+        TFuture<FMCPToolResult>& OutResult);
+
+    int32 GetSnapshotCount() const;
+
+private:
+    struct FSnapshot
+    {
+        FMCPResultList List;
+        FGuid SessionId;
+        FString Tool;
+        int32 PageSize = 0;
+        double ExpireTime = 0.0;
+    };
+
+    static FMCPToolResult MakePage(const FString& Id, const FSnapshot& Snapshot, int32 Offset);
+    void PruneExpired(double Now);
+
+    mutable FCriticalSection Lock;
+    TMap<FString, TSharedPtr<const FSnapshot>> Snapshots;
+};
@@ -2,9 +2,44 @@
 
 #include "CoreMinimal.h"
 
+/**
+ * A search pattern compiled once and matched against many values. Copies share the compiled form,
+ * and Matches() is safe to call from several threads. A default-constructed pattern matches everything.
+ *
+ * Globs ('*', '?', comma or '|' alternatives) are matched natively and case-insensitively anywhere in
+ * the value; only /regex/ patterns go through ICU.
+ */
+class LERVIKMCP_API FMCPCompiledPattern
+{
+public:
+    FMCPCompiledPattern() = default;
+    explicit FMCPCompiledPattern(const FString& InPattern);
+
+    bool IsEmpty() const { return Pattern.IsEmpty(); }
+    const FString& GetPattern() const { return Pattern; }
+    bool Matches(const FString& Value) const;
+
+    /**
+     * Lower-case literal runs (text between wildcards) that each alternative requires, for index lookups.
+     * Returns false when the pattern cannot be narrowed that way: empty, /regex/, or an alternative that
+     * matches everything.
+     */
+    bool GetRequiredLiterals(TArray<TArray<FString>>& OutAlternatives) const;
+
+private:
+    struct FImpl;
+
+    FString Pattern;
+    TSharedPtr<const FImpl, ESPMode::ThreadSafe> Impl;
+};
+
 class LERVIKMCP_API FMCPSearchPatterns
 {
 public:
+    /** Returns the compiled form of Pattern, reusing it from a small LRU of recently used patterns. */
+    static FMCPCompiledPattern Compile(const FString& Pattern);
+
+    /** One-off match. Prefer Compile() once per request when matching many values. */
     static bool Matches(const FString& Pattern, const FString& Value);
     static FString WildcardToRegex(const FString& Wildcard);
     static TArray<FString> FilterStrings(const TArray<FString>& Values, const FString& Pattern);
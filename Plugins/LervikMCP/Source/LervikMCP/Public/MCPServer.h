@@ -2,6 +2,10 @@
 
 #include "CoreMinimal.h"
 #include "MCPSession.h"
+#include "MCPWorkerPool.h"
+#include "MCPRequestMetrics.h"
+#include "MCPToolRegistry.h"
+#include "MCPToolContext.h"
 #include "HttpRouteHandle.h"
 #include "HttpResultCallback.h"
 #include "HAL/ThreadSafeCounter.h"
@@ -9,6 +13,14 @@
 class IHttpRouter;
 struct FHttpServerRequest;
 
+/** Serialized tools/list "result" object plus its ETag, rebuilt only when the registered tools change. */
+struct FMCPToolsListCache
+{
+    TArray<uint8> ResultUtf8;
+    FString ETag;
+    uint32 Generation = 0;
+};
+
 class LERVIKMCP_API FMCPServer
 {
 public:
@@ -18,21 +30,43 @@ public:
     bool IsRunning() const;
     uint32 GetPort() const;
     FMCPSessionManager& GetSessionManager();
-    TOptional<FMCPSession> GetSessionSnapshot() const;
+    TArray<FMCPSession> GetSessionSnapshots() const;
+    const FMCPWorkerPool& GetWorkerPool() const;
+    const FMCPRequestMetrics& GetRequestMetrics() const;
 
 private:
     bool HandleMcpRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
     bool HandleMethodNotAllowed(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+    bool HandleBatchRequest(const FHttpServerRequest& Request, TArray<FMCPRequest>&& Requests, const FHttpResultCallback& OnComplete);
+    bool HandleDeleteSession(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+    TSharedRef<const FMCPToolsListCache> GetToolsListCache();
+
+    void TrackCall(const TSharedPtr<FJsonValue>& Id, const FMCPToolContext& Context);
+    void UntrackCall(const TSharedPtr<FJsonValue>& Id, const FMCPToolContext& Context);
+    void HandleCancelledNotification(const FMCPRequest& Notification, const FMCPSessionStatePtr& Session);
+
+    /** Session named by the request's Mcp-Session-Id header, or the static session without one. Null if the header names an unknown or evicted session. */
+    FMCPSessionStatePtr ResolveSession(const FHttpServerRequest& Request);
 
     FMCPSessionManager SessionManager;
+    FMCPSessionStatePtr DefaultSession;
+    FMCPWorkerPool WorkerPool;
+    FMCPRequestMetrics RequestMetrics;
+    FMCPToolRegistry ToolRegistry;
     TSharedPtr<IHttpRouter> HttpRouter;
     FHttpRouteHandle RouteHandle;
     FHttpRouteHandle SseRouteHandle;
     FHttpRouteHandle GetMcpRouteHandle;
+    FHttpRouteHandle DeleteMcpRouteHandle;
     FDelegateHandle PreprocessorHandle;
     uint32 ServerPort = 0;
     bool bIsRunning = false;
     TAtomic<bool> bShuttingDown{false};
     FThreadSafeCounter InFlightTaskCount;
-    mutable FCriticalSection SessionLock;
+    FCriticalSection ToolsListLock;
+    TSharedPtr<const FMCPToolsListCache> ToolsListCache;
+
+    /** Contexts of running tools/call requests by JSON-RPC id, so notifications/cancelled can reach them. */
+    TMap<FString, FMCPToolContext> InFlightCalls;
+    FCriticalSection InFlightCallsLock;
 };
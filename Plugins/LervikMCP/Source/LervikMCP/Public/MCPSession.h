@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "MCPCompactGuidTable.h"
 #include "HAL/CriticalSection.h"
 
 struct LERVIKMCP_API FMCPSession
@@ -12,23 +13,110 @@ struct LERVIKMCP_API FMCPSession
     FDateTime CreatedAt;
 };
 
+/**
+ * Live state of one session, shared by every request that carries its Mcp-Session-Id.
+ * Owns the session's compact GUID namespace and its tools/call rate limit. Thread-safe.
+ */
+class LERVIKMCP_API FMCPSessionState : public TSharedFromThis<FMCPSessionState, ESPMode::ThreadSafe>
+{
+public:
+    FMCPSessionState(const FMCPSession& InInfo, bool bInPinned);
+
+    const FMCPSession& GetInfo() const { return Info; }
+    FMCPCompactGuidTable& GetGuidTable() { return GuidTable; }
+
+    /** Pinned sessions are never evicted for being idle. */
+    bool IsPinned() const { return bPinned; }
+
+    /** Marks the session as used now, restarting its idle timer. */
+    void Touch();
+    double GetIdleSeconds() const;
+
+    /**
+     * Takes one token from the session's tools/call bucket, refilled at RatePerSecond up to Burst tokens.
+     * Always succeeds when RatePerSecond <= 0.
+     */
+    bool TryConsumeCall(double RatePerSecond, double Burst);
+
+private:
+    FMCPSession Info;
+    FMCPCompactGuidTable GuidTable;
+    bool bPinned = false;
+    TAtomic<uint64> LastActiveCycles { 0 };
+
+    FCriticalSection RateLock;
+    double Tokens = -1.0;
+    double LastRefillSeconds = 0.0;
+};
+
+using FMCPSessionStatePtr = TSharedPtr<FMCPSessionState, ESPMode::ThreadSafe>;
+
+/**
+ * Makes Session the one compact GUID lookups on this thread resolve against until the scope ends.
+ * Scopes nest; the server opens one around each tools/call and the game-thread helpers carry it across.
+ */
+class LERVIKMCP_API FMCPSessionScope
+{
+public:
+    explicit FMCPSessionScope(FMCPSessionStatePtr InSession);
+    ~FMCPSessionScope();
+
+    FMCPSessionScope(const FMCPSessionScope&) = delete;
+    FMCPSessionScope& operator=(const FMCPSessionScope&) = delete;
+
+    /** Session of the innermost scope on this thread, or null. */
+    static FMCPSessionStatePtr GetCurrent();
+
+private:
+    FMCPSessionStatePtr Session;
+    FMCPSessionState* Previous = nullptr;
+};
+
+/**
+ * Every live session by ID. Lookups take a read lock on one of 16 shards, so concurrent requests
+ * from different clients don't serialize. Sessions idle for longer than mcp.session_idle_timeout_seconds
+ * are evicted on a later lookup.
+ */
 class LERVIKMCP_API FMCPSessionManager
 {
 public:
-    FMCPSession CreateSession(const FString& ClientName, const FString& ClientVersion, const FString& ProtocolVersion);
+    /** Registers a new session. Pinned sessions survive idle eviction. */
+    FMCPSession CreateSession(const FString& ClientName, const FString& ClientVersion, const FString& ProtocolVersion, bool bPinned = false);
+
+    /** State of SessionId with its idle timer restarted, or null if it never existed or was evicted. */
+    FMCPSessionStatePtr FindSession(const FGuid& SessionId);
+
     bool HasSession() const;
-    const FMCPSession* GetSession() const;
-    void DestroySession();
+    int32 Num() const;
+    TArray<FMCPSession> GetSessions() const;
+
+    bool DestroySession(const FGuid& SessionId);
+    void DestroyAllSessions();
+
+    /** Drops every unpinned session idle for longer than MaxIdleSeconds. Returns how many were dropped. */
+    int32 EvictIdleSessions(double MaxIdleSeconds);
 
+    /** Compact IDs are per session: these use the session of the current FMCPSessionScope, or a table shared by callers outside any session. */
     FString GuidToCompact(const FGuid& Guid);
     FGuid CompactToGuid(const FString& Compact);
     void ResetGuidMap();
 
 private:
-    TOptional<FMCPSession> CurrentSession;
+    static constexpr int32 NumShards = 16;
+
+    struct alignas(PLATFORM_CACHE_LINE_SIZE) FShard
+    {
+        mutable FRWLock Lock;
+        TMap<FGuid, FMCPSessionStatePtr> Sessions;
+    };
+
+    FShard& GetShard(const FGuid& SessionId) { return Shards[GetTypeHash(SessionId) % NumShards]; }
+    FMCPCompactGuidTable& GetCurrentGuidTable();
+    void MaybeEvictIdleSessions();
+
+    FShard Shards[NumShards];
+    TAtomic<int32> NumSessions { 0 };
+    TAtomic<uint64> NextSweepCycles { 0 };
 
-    TMap<FGuid, int32> GuidToIndexMap;
-    TArray<FGuid> IndexToGuidArray;
-    int32 NextGuidIndex = 0;
-    FCriticalSection GuidMapLock;
+    FMCPCompactGuidTable SharedGuidTable;
 };
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+#include "MCPSession.h"
+
+/**
+ * Per-call state handed to IMCPTool::ExecuteAsync. Cheap to copy; copies refer to the same call.
+ * A default-constructed context belongs to no client request: it drops progress reports and is never cancelled.
+ */
+class LERVIKMCP_API FMCPToolContext
+{
+public:
+    using FProgressHandler = TFunction<void(double Progress, double Total, const FString& Message)>;
+
+    FMCPToolContext() = default;
+    explicit FMCPToolContext(FProgressHandler&& InProgressHandler, FMCPSessionStatePtr InSession = FMCPSessionStatePtr());
+
+    /** True if the client asked for progress notifications on this call. */
+    bool WantsProgress() const;
+
+    /**
+     * Queues a notifications/progress for this call. Total <= 0 means unknown. Safe from any thread.
+     * The client receives queued events together with the result, not as they are reported.
+     */
+    void ReportProgress(double Progress, double Total = 0.0, const FString& Message = FString()) const;
+
+    /**
+     * Set once the client sends notifications/cancelled for this call. The notification is handled on the
+     * game thread, so it can't land while game-thread work runs: it only skips game-thread work that hasn't
+     * started (see ExecuteOnGameThreadAsync). Long loops on worker threads should poll this and bail out.
+     */
+    bool IsCancelled() const;
+    void Cancel() const;
+
+    /** Session the call was made in. Null for contexts that belong to no client request. */
+    FMCPSessionStatePtr GetSession() const;
+
+    /** True if both contexts refer to the same call. */
+    bool operator==(const FMCPToolContext& Other) const { return State == Other.State; }
+
+private:
+    struct FState
+    {
+        FProgressHandler ProgressHandler;
+        TAtomic<bool> bCancelled{false};
+        FMCPSessionStatePtr Session;
+    };
+
+    TSharedPtr<FState, ESPMode::ThreadSafe> State;
+};
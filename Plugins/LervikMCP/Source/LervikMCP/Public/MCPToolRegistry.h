@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCPTypes.h"
+#include "Misc/ScopeRWLock.h"
+
+class IMCPTool;
+class IModularFeature;
+
+/**
+ * Name-keyed cache of the IMCPTool modular features.
+ * Rebuilt lazily after a tool is registered or unregistered, so tools/call dispatch
+ * is a hash lookup instead of a GetToolInfo() call on every registered tool.
+ */
+class LERVIKMCP_API FMCPToolRegistry
+{
+public:
+    ~FMCPToolRegistry();
+
+    void Initialize();
+    void Shutdown();
+
+    IMCPTool* FindTool(FName ToolName, bool* bOutRunsOnGameThread = nullptr);
+    IMCPTool* FindTool(const FString& ToolName, bool* bOutRunsOnGameThread = nullptr);
+
+    /** Registered tools in registration order. */
+    TArray<IMCPTool*> GetTools();
+    TArray<FMCPToolInfo> GetToolInfos();
+
+    /** Incremented every time the set of registered tools changes. */
+    uint32 GetGeneration() const;
+
+private:
+    void HandleModularFeatureChanged(const FName& Type, IModularFeature* ModularFeature);
+    void RebuildIfDirty();
+
+    FRWLock Lock;
+    TArray<IMCPTool*> Tools;
+    TArray<FMCPToolInfo> ToolInfos;
+    TMap<FName, int32> ToolIndexByName;
+    TAtomic<bool> bDirty{true};
+    TAtomic<uint32> Generation{0};
+    FDelegateHandle RegisteredHandle;
+    FDelegateHandle UnregisteredHandle;
+};
@@ -11,6 +11,8 @@ namespace MCPErrorCodes
     constexpr int32 MethodNotFound = -32601;
     constexpr int32 InvalidParams = -32602;
     constexpr int32 InternalError = -32603;
+    constexpr int32 ServerBusy = -32000;
+    constexpr int32 RateLimited = -32001;
 }
 
 struct LERVIKMCP_API FMCPToolParameter
@@ -27,6 +29,12 @@ struct LERVIKMCP_API FMCPToolInfo
     FName Name;
     FString Description;
     TArray<FMCPToolParameter> Parameters;
+
+    /**
+     * True if Execute() does its work on the game thread. Game-thread tools in a JSON-RPC batch are
+     * run back to back in one game-thread hop; other tools run concurrently on the MCP worker pool.
+     */
+    bool bRunsOnGameThread = true;
 };
 
 struct LERVIKMCP_API FMCPToolResult
@@ -34,8 +42,19 @@ struct LERVIKMCP_API FMCPToolResult
     FString Content;
     bool bIsError = false;
 
+    /**
+     * UTF-8 text for tools that write their payload with FMCPJsonWriter. When set, it is sent instead of
+     * Content and escaped straight into the response, so the payload never passes through an FString.
+     */
+    TArray<uint8> ContentUtf8;
+
     static FMCPToolResult Text(const FString& InContent);
+    static FMCPToolResult Utf8(TArray<uint8>&& InContentUtf8);
     static FMCPToolResult Error(const FString& ErrorMessage);
+    static FMCPToolResult Cancelled();
+
+    /** Content as a string, decoding ContentUtf8 if that is what the tool produced. */
+    FString GetText() const;
 };
 
 struct LERVIKMCP_API FMCPRequest
@@ -45,7 +64,19 @@ struct LERVIKMCP_API FMCPRequest
     TSharedPtr<FJsonValue> Id;
     bool bIsNotification = false;
 
+    /** Set on batch entries that failed validation; the entry is answered with an InvalidRequest error. */
+    FString ParseError;
+
     static bool Parse(const FString& JsonString, FMCPRequest& OutRequest, FString& OutError);
+
+    /**
+     * Parses either a single request object or a JSON-RPC 2.0 batch array.
+     * Returns false if the body is not valid JSON or a single (non-batch) request is malformed.
+     */
+    static bool ParseMessage(const FString& JsonString, TArray<FMCPRequest>& OutRequests, bool& bOutIsBatch, FString& OutError);
+
+    /** Same as above, reading a UTF-8 body in place without converting it to TCHAR first. */
+    static bool ParseMessage(FUtf8StringView Utf8Json, TArray<FMCPRequest>& OutRequests, bool& bOutIsBatch, FString& OutError);
 };
 
 struct LERVIKMCP_API FMCPResponse
@@ -53,4 +84,11 @@ struct LERVIKMCP_API FMCPResponse
     static FString Success(const TSharedPtr<FJsonValue>& Id, const TSharedPtr<FJsonObject>& Result);
     static FString Success(const TSharedPtr<FJsonValue>& Id, const TSharedPtr<FJsonValue>& Result);
     static FString Error(const TSharedPtr<FJsonValue>& Id, int32 Code, const FString& Message);
+    static FString Notification(const FString& Method, const TSharedPtr<FJsonObject>& Params);
+
+    /** Wraps an already-serialized UTF-8 result in the JSON-RPC envelope without building a DOM for it. */
+    static TArray<uint8> SuccessRaw(const TSharedPtr<FJsonValue>& Id, TConstArrayView<uint8> ResultUtf8);
+
+    /** tools/call response for a tool result, written as UTF-8 with the tool text escaped once in place. */
+    static TArray<uint8> ToolCallSuccess(const TSharedPtr<FJsonValue>& Id, const FMCPToolResult& ToolResult);
 };
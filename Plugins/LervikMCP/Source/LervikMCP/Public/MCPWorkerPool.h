@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+class FQueuedThreadPool;
+
+/**
+ * Fixed-size thread pool for MCP tool execution with a bounded pending queue.
+ * Work that would exceed the queue depth is rejected instead of queued, so the
+ * server can answer "server busy" rather than growing without limit.
+ */
+class LERVIKMCP_API FMCPWorkerPool
+{
+public:
+    ~FMCPWorkerPool();
+
+    bool Start(int32 InNumWorkers, int32 InMaxQueueDepth);
+
+    /**
+     * Waits for running work to finish. Work still waiting in the queue is dropped and its OnAbandoned runs instead.
+     * Called on the game thread, it keeps running FMCPGameThreadQueue work while it waits, so tools blocked on the
+     * game thread can finish.
+     */
+    void Stop();
+
+    bool IsRunning() const;
+
+    /**
+     * Returns false (and does not run Work) if the pool is stopped or the queue is full.
+     * OnAbandoned runs instead of Work if Stop() drops the item before a worker picks it up.
+     */
+    bool TryEnqueue(TUniqueFunction<void()>&& Work, TUniqueFunction<void()>&& OnAbandoned = nullptr);
+
+    /** Number of work items accepted but not yet picked up by a worker. */
+    int32 GetQueueDepth() const;
+    int32 GetActiveCount() const;
+    int32 GetNumWorkers() const;
+    int32 GetMaxQueueDepth() const;
+    void SetMaxQueueDepth(int32 InMaxQueueDepth);
+
+private:
+    friend class FMCPQueuedWork;
+
+    FQueuedThreadPool* ThreadPool = nullptr;
+    int32 NumWorkers = 0;
+    TAtomic<int32> MaxQueueDepth{0};
+    TAtomic<int32> PendingCount{0};
+    TAtomic<int32> ActiveCount{0};
+};
@@ -6,6 +6,9 @@
 #include "Styling/AppStyle.h"
 #include "HAL/IConsoleManager.h"
 #include "HAL/PlatformApplicationMisc.h"
+#include "MCPActorIndex.h"
+#include "MCPAssetNameIndex.h"
+#include "MCPClassIndex.h"
 #include "Tools/MCPTool_GetOpenAssets.h"
 #include "Tools/MCPTool_Find.h"
 #include "Tools/MCPTool_Inspect.h"
@@ -46,6 +49,8 @@ void FLervikMCPEditorModule::StartupModule()
         IModularFeatures::Get().RegisterModularFeature(IMCPTool::GetModularFeatureName(), Tool.Get());
     }
 
+    FMCPAssetNameIndex::Get().Startup();
+
     UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateRaw(this, &FLervikMCPEditorModule::RegisterMenus));
 }
 
@@ -58,6 +63,10 @@ void FLervikMCPEditorModule::ShutdownModule()
         IModularFeatures::Get().UnregisterModularFeature(IMCPTool::GetModularFeatureName(), Tool.Get());
     }
     Tools.Empty();
+
+    FMCPAssetNameIndex::Get().Shutdown();
+    FMCPActorIndex::Get().Shutdown();
+    FMCPClassIndex::Get().Shutdown();
 }
 
 void FLervikMCPEditorModule::RegisterMenus()
@@ -0,0 +1,386 @@
+#include "MCPActorIndex.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/SceneComponent.h"
+#include "UObject/UObjectGlobals.h"
+#include "Misc/CoreDelegates.h"
+#include "ConvexVolume.h"
+#include "Subsystems/EditorActorSubsystem.h"
+
+namespace
+{
+    /** Label entries are kept in the order actors were indexed, so duplicate labels resolve as the old scan did. */
+    template<typename TKey>
+    void RemoveFromList(TMap<TKey, TArray<TWeakObjectPtr<AActor>, TInlineAllocator<1>>>& Map, const TKey& Key, AActor* Actor)
+    {
+        if (auto* List = Map.Find(Key))
+        {
+            List->Remove(Actor);
+            if (List->Num() == 0)
+            {
+                Map.Remove(Key);
+            }
+        }
+    }
+
+    /** Linear scan with the original ResolveActor semantics: first label match, then first internal-name match. */
+    AActor* ScanLevelActors(const FString& LabelOrName)
+    {
+        UEditorActorSubsystem* ActorSubsystem = GEditor ? GEditor->GetEditorSubsystem<UEditorActorSubsystem>() : nullptr;
+        if (!ActorSubsystem)
+        {
+            return nullptr;
+        }
+
+        TArray<AActor*> AllActors = ActorSubsystem->GetAllLevelActors();
+        for (AActor* Actor : AllActors)
+        {
+            if (Actor && Actor->GetActorLabel().Equals(LabelOrName, ESearchCase::IgnoreCase))
+            {
+                return Actor;
+            }
+        }
+        for (AActor* Actor : AllActors)
+        {
+            if (Actor && Actor->GetName().Equals(LabelOrName, ESearchCase::IgnoreCase))
+            {
+                return Actor;
+            }
+        }
+        return nullptr;
+    }
+}
+
+FMCPActorIndex& FMCPActorIndex::Get()
+{
+    static FMCPActorIndex Instance;
+    return Instance;
+}
+
+AActor* FMCPActorIndex::Find(const FString& LabelOrName)
+{
+    check(IsInGameThread());
+
+    if (!EnsureCurrent())
+    {
+        return nullptr;
+    }
+
+    if (const FActorList* Actors = ByLabel.Find(LabelOrName.ToLower()))
+    {
+        for (const TWeakObjectPtr<AActor>& Weak : *Actors)
+        {
+            AActor* Actor = Weak.Get();
+            if (IsValid(Actor) && Actor->GetActorLabel().Equals(LabelOrName, ESearchCase::IgnoreCase))
+            {
+                return Actor;
+            }
+        }
+    }
+
+    // FNAME_Find never adds to the name table; a name that doesn't exist can't belong to an actor.
+    const FName Name(*LabelOrName, FNAME_Find);
+    if (!Name.IsNone())
+    {
+        if (const FActorList* Actors = ByName.Find(Name))
+        {
+            for (const TWeakObjectPtr<AActor>& Weak : *Actors)
+            {
+                AActor* Actor = Weak.Get();
+                if (IsValid(Actor) && Actor->GetFName() == Name)
+                {
+                    return Actor;
+                }
+            }
+        }
+    }
+
+    // Not every way an actor can appear or be renamed has an event (e.g. Rename() of the object itself).
+    // Misses are rare and usually errors, so confirm with a full scan and rebuild if the index was stale.
+    AActor* Scanned = ScanLevelActors(LabelOrName);
+    if (Scanned)
+    {
+        Invalidate();
+    }
+    return Scanned;
+}
+
+int32 FMCPActorIndex::Num()
+{
+    check(IsInGameThread());
+    EnsureCurrent();
+    return IndexedLabels.Num();
+}
+
+void FMCPActorIndex::ForEachActorInBox(const FBox& Box, TFunctionRef<void(AActor*)> Func)
+{
+    check(IsInGameThread());
+    if (!EnsureCurrent())
+    {
+        return;
+    }
+
+    Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Box), [&Func](const FOctreeElement& Element)
+    {
+        if (AActor* Actor = Element.Actor.Get())
+        {
+            Func(Actor);
+        }
+    });
+}
+
+void FMCPActorIndex::ForEachActorInFrustum(const FConvexVolume& Frustum, TFunctionRef<void(AActor*)> Func)
+{
+    check(IsInGameThread());
+    if (!EnsureCurrent())
+    {
+        return;
+    }
+
+    // Descend only into nodes whose loose bounds touch the frustum; elements are then tested individually.
+    Octree->FindElementsWithPredicate(
+        [&Frustum](auto /*ParentNodeIndex*/, auto /*NodeIndex*/, const FBoxCenterAndExtent& NodeBounds)
+        {
+            return Frustum.IntersectBox(FVector(NodeBounds.Center), FVector(NodeBounds.Extent));
+        },
+        [&Frustum, &Func](auto /*ParentNodeIndex*/, const FOctreeElement& Element)
+        {
+            AActor* Actor = Element.Actor.Get();
+            if (Actor && Frustum.IntersectBox(FVector(Element.Bounds.Center), FVector(Element.Bounds.Extent)))
+            {
+                Func(Actor);
+            }
+        });
+}
+
+FBoxCenterAndExtent FMCPActorIndex::GetActorQueryBounds(const AActor* Actor)
+{
+    FVector Origin;
+    FVector Extent;
+    Actor->GetActorBounds(false, Origin, Extent);
+    if (Extent.IsNearlyZero())
+    {
+        return FBoxCenterAndExtent(Actor->GetActorLocation(), FVector::ZeroVector);
+    }
+    return FBoxCenterAndExtent(Origin, Extent);
+}
+
+void FMCPActorIndex::NotifyActorMoved(AActor* Actor)
+{
+    HandleActorMoved(Actor);
+}
+
+void FMCPActorIndex::Shutdown()
+{
+    if (bSubscribed)
+    {
+        if (GEngine)
+        {
+            GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+            GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+            GEngine->OnActorMoved().Remove(ActorMovedHandle);
+            GEngine->OnLevelActorListChanged().Remove(ActorListChangedHandle);
+        }
+        FCoreDelegates::OnActorLabelChanged.Remove(LabelChangedHandle);
+        FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+        FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+        FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+        FCoreUObjectDelegates::OnObjectTransacted.Remove(ObjectTransactedHandle);
+        bSubscribed = false;
+    }
+    Invalidate();
+}
+
+UWorld* FMCPActorIndex::EnsureCurrent()
+{
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        Invalidate();
+        return nullptr;
+    }
+
+    Subscribe();
+    if (bDirty || IndexedWorld.Get() != World)
+    {
+        Rebuild(World);
+    }
+    return World;
+}
+
+void FMCPActorIndex::Rebuild(UWorld* World)
+{
+    Invalidate();
+    IndexedWorld = World;
+    Octree = MakeUnique<FActorOctree>(FVector::ZeroVector, HALF_WORLD_MAX);
+
+    UEditorActorSubsystem* ActorSubsystem = GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
+    if (!ActorSubsystem)
+    {
+        return;
+    }
+
+    const TArray<AActor*> AllActors = ActorSubsystem->GetAllLevelActors();
+    ByLabel.Reserve(AllActors.Num());
+    ByName.Reserve(AllActors.Num());
+    IndexedLabels.Reserve(AllActors.Num());
+    for (AActor* Actor : AllActors)
+    {
+        AddActor(Actor);
+    }
+    bDirty = false;
+}
+
+void FMCPActorIndex::Subscribe()
+{
+    // GEngine doesn't exist yet when the editor module starts, so hook up on first use.
+    if (bSubscribed || !GEngine)
+    {
+        return;
+    }
+
+    ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FMCPActorIndex::HandleActorAdded);
+    ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FMCPActorIndex::HandleActorDeleted);
+    ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FMCPActorIndex::HandleActorMoved);
+    ActorListChangedHandle = GEngine->OnLevelActorListChanged().AddRaw(this, &FMCPActorIndex::Invalidate);
+    LabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FMCPActorIndex::HandleActorLabelChanged);
+    LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(this, &FMCPActorIndex::HandleLevelChanged);
+    LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddRaw(this, &FMCPActorIndex::HandleLevelChanged);
+    PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FMCPActorIndex::HandleObjectPropertyChanged);
+    ObjectTransactedHandle = FCoreUObjectDelegates::OnObjectTransacted.AddRaw(this, &FMCPActorIndex::HandleObjectTransacted);
+    bSubscribed = true;
+}
+
+void FMCPActorIndex::Invalidate()
+{
+    bDirty = true;
+    IndexedWorld.Reset();
+    ByLabel.Reset();
+    ByName.Reset();
+    IndexedLabels.Reset();
+    ElementIds.Reset();
+    Octree.Reset();
+}
+
+void FMCPActorIndex::AddActor(AActor* Actor)
+{
+    if (!IsValid(Actor) || Actor->IsTemplate() || Actor->HasAnyFlags(RF_Transient) || Actor->GetWorld() != IndexedWorld.Get()
+        || IndexedLabels.Contains(Actor))
+    {
+        return;
+    }
+
+    FString Label = Actor->GetActorLabel().ToLower();
+    ByLabel.FindOrAdd(Label).AddUnique(Actor);
+    ByName.FindOrAdd(Actor->GetFName()).AddUnique(Actor);
+    IndexedLabels.Add(Actor, MoveTemp(Label));
+    AddToOctree(Actor);
+}
+
+void FMCPActorIndex::RemoveActor(AActor* Actor)
+{
+    FString Label;
+    if (!IndexedLabels.RemoveAndCopyValue(Actor, Label))
+    {
+        return;
+    }
+
+    RemoveFromList(ByLabel, Label, Actor);
+    RemoveFromList(ByName, Actor->GetFName(), Actor);
+    RemoveFromOctree(Actor);
+}
+
+void FMCPActorIndex::AddToOctree(AActor* Actor)
+{
+    FOctreeElement Element;
+    Element.Actor = Actor;
+    Element.Bounds = GetActorQueryBounds(Actor);
+    Element.ElementIds = &ElementIds;
+    Octree->AddElement(Element);
+}
+
+void FMCPActorIndex::RemoveFromOctree(AActor* Actor)
+{
+    FOctreeElementId2 Id;
+    if (ElementIds.RemoveAndCopyValue(Actor, Id) && Id.IsValidId())
+    {
+        Octree->RemoveElement(Id);
+    }
+}
+
+void FMCPActorIndex::HandleActorAdded(AActor* Actor)
+{
+    if (!bDirty)
+    {
+        AddActor(Actor);
+    }
+}
+
+void FMCPActorIndex::HandleActorDeleted(AActor* Actor)
+{
+    if (!bDirty)
+    {
+        RemoveActor(Actor);
+    }
+}
+
+void FMCPActorIndex::HandleActorMoved(AActor* Actor)
+{
+    if (!bDirty && ElementIds.Contains(Actor))
+    {
+        RemoveFromOctree(Actor);
+        AddToOctree(Actor);
+    }
+}
+
+void FMCPActorIndex::HandleActorLabelChanged(AActor* Actor)
+{
+    FString* IndexedLabel = bDirty ? nullptr : IndexedLabels.Find(Actor);
+    if (!IndexedLabel)
+    {
+        return;
+    }
+
+    FString Label = Actor->GetActorLabel().ToLower();
+    if (Label != *IndexedLabel)
+    {
+        RemoveFromList(ByLabel, *IndexedLabel, Actor);
+        ByLabel.FindOrAdd(Label).AddUnique(Actor);
+        *IndexedLabel = MoveTemp(Label);
+    }
+}
+
+void FMCPActorIndex::HandleLevelChanged(ULevel* Level, UWorld* World)
+{
+    if (World && World == IndexedWorld.Get())
+    {
+        Invalidate();
+    }
+}
+
+void FMCPActorIndex::HandleObjectPropertyChanged(UObject* Obj, FPropertyChangedEvent& Event)
+{
+    HandleObjectChanged(Obj);
+}
+
+void FMCPActorIndex::HandleObjectTransacted(UObject* Obj, const FTransactionObjectEvent& Event)
+{
+    HandleObjectChanged(Obj);
+}
+
+void FMCPActorIndex::HandleObjectChanged(UObject* Obj)
+{
+    if (AActor* Actor = Cast<AActor>(Obj))
+    {
+        HandleActorMoved(Actor);
+    }
+    else if (USceneComponent* Component = Cast<USceneComponent>(Obj))
+    {
+        if (AActor* Owner = Component->GetOwner())
+        {
+            HandleActorMoved(Owner);
+        }
+    }
+}
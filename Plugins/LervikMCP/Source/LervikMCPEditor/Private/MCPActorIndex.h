@@ -0,0 +1,150 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Math/GenericOctree.h"
+
+class AActor;
+class ULevel;
+class UObject;
+class UWorld;
+struct FConvexVolume;
+struct FPropertyChangedEvent;
+class FTransactionObjectEvent;
+
+/**
+ * Lookup of editor-world actors by label and by internal name for FMCPObjectResolver::ResolveActor, plus a
+ * loose octree of actor bounds for spatial find queries. Built lazily from the same actor set as
+ * UEditorActorSubsystem::GetAllLevelActors and kept current from the engine's actor added/deleted/moved/
+ * label-changed events, plus property-changed and undo/redo events on actors and their scene components.
+ * A world or level change marks it for a rebuild. Game thread only.
+ */
+class FMCPActorIndex
+{
+public:
+    static FMCPActorIndex& Get();
+
+    /** Label matches (case-insensitive) take precedence over internal-name matches. Returns null if neither exists. */
+    AActor* Find(const FString& LabelOrName);
+
+    /** Number of indexed actors, building the index if needed. */
+    int32 Num();
+
+    /**
+     * Calls Func for each actor whose indexed bounds intersect Box / Frustum. Bounds are refreshed on move,
+     * property-change and undo/redo events only, so callers that need exact answers should re-test the live actor.
+     */
+    void ForEachActorInBox(const FBox& Box, TFunctionRef<void(AActor*)> Func);
+    void ForEachActorInFrustum(const FConvexVolume& Frustum, TFunctionRef<void(AActor*)> Func);
+
+    /**
+     * Refreshes Actor's indexed bounds. SetActorLocation and friends fire no move event, so MCP tools that
+     * transform actors or change their components directly must call this afterwards.
+     */
+    void NotifyActorMoved(AActor* Actor);
+
+    /**
+     * Drops the index so the next query rebuilds it. For tools that run arbitrary code (Python, console
+     * commands), which can move or rename actors without firing any event.
+     */
+    void Invalidate();
+
+    /** World-space bounds used by the spatial index; actors without primitive bounds are a point at their location. */
+    static FBoxCenterAndExtent GetActorQueryBounds(const AActor* Actor);
+
+    void Shutdown();
+
+private:
+    using FActorList = TArray<TWeakObjectPtr<AActor>, TInlineAllocator<1>>;
+    using FElementIdMap = TMap<TWeakObjectPtr<AActor>, FOctreeElementId2>;
+
+    struct FOctreeElement
+    {
+        TWeakObjectPtr<AActor> Actor;
+        FBoxCenterAndExtent Bounds;
+        /** The octree reports element moves through SetElementId; this is where they are recorded. */
+        FElementIdMap* ElementIds = nullptr;
+    };
+
+    struct FOctreeSemantics
+    {
+        enum { MaxElementsPerLeaf = 16 };
+        enum { MinInclusiveElementsPerNode = 7 };
+        enum { MaxNodeDepth = 12 };
+
+        typedef TInlineAllocator<MaxElementsPerLeaf> ElementAllocator;
+
+        FORCEINLINE static const FBoxCenterAndExtent& GetBoundingBox(const FOctreeElement& Element)
+        {
+            return Element.Bounds;
+        }
+
+        FORCEINLINE static bool AreElementsEqual(const FOctreeElement& A, const FOctreeElement& B)
+        {
+            return A.Actor == B.Actor;
+        }
+
+        FORCEINLINE static void SetElementId(const FOctreeElement& Element, FOctreeElementId2 Id)
+        {
+            if (Id.IsValidId())
+            {
+                Element.ElementIds->Add(Element.Actor, Id);
+            }
+            else
+            {
+                Element.ElementIds->Remove(Element.Actor);
+            }
+        }
+
+        FORCEINLINE static void ApplyOffset(FOctreeElement& Element, const FVector& Offset)
+        {
+            Element.Bounds = FBoxCenterAndExtent(Element.Bounds.GetBox().ShiftBy(Offset));
+        }
+    };
+
+    using FActorOctree = TOctree2<FOctreeElement, FOctreeSemantics>;
+
+    /** Returns the editor world, rebuilding first if it changed or the index was invalidated. */
+    UWorld* EnsureCurrent();
+    void Rebuild(UWorld* World);
+    void Subscribe();
+
+    void AddActor(AActor* Actor);
+    void RemoveActor(AActor* Actor);
+    void AddToOctree(AActor* Actor);
+    void RemoveFromOctree(AActor* Actor);
+
+    void HandleActorAdded(AActor* Actor);
+    void HandleActorDeleted(AActor* Actor);
+    void HandleActorMoved(AActor* Actor);
+    void HandleActorLabelChanged(AActor* Actor);
+    void HandleLevelChanged(ULevel* Level, UWorld* World);
+    void HandleObjectPropertyChanged(UObject* Obj, FPropertyChangedEvent& Event);
+    void HandleObjectTransacted(UObject* Obj, const FTransactionObjectEvent& Event);
+    /** Refreshes the bounds of Obj if it is an actor, or of its owner if it is a scene component. */
+    void HandleObjectChanged(UObject* Obj);
+
+    TWeakObjectPtr<UWorld> IndexedWorld;
+    bool bDirty = true;
+    bool bSubscribed = false;
+
+    /** Keyed by lower-cased label. */
+    TMap<FString, FActorList> ByLabel;
+    /** FName comparison is already case-insensitive. */
+    TMap<FName, FActorList> ByName;
+    /** Label each actor was indexed under, so a label change can remove the old key. */
+    TMap<TWeakObjectPtr<AActor>, FString> IndexedLabels;
+
+    TUniquePtr<FActorOctree> Octree;
+    FElementIdMap ElementIds;
+
+    FDelegateHandle ActorAddedHandle;
+    FDelegateHandle ActorDeletedHandle;
+    FDelegateHandle ActorMovedHandle;
+    FDelegateHandle ActorListChangedHandle;
+    FDelegateHandle LabelChangedHandle;
+    FDelegateHandle LevelAddedHandle;
+    FDelegateHandle LevelRemovedHandle;
+    FDelegateHandle PropertyChangedHandle;
+    FDelegateHandle ObjectTransactedHandle;
+};
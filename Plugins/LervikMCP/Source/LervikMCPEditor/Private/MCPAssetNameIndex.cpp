@@ -0,0 +1,358 @@
+#include "MCPAssetNameIndex.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Async/Async.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace
+{
+    /** Tombstones are compacted away once they are both numerous and a large share of the index. */
+    constexpr int32 MinRemovedBeforeCompact = 1024;
+
+    uint64 MakeTrigram(TCHAR A, TCHAR B, TCHAR C)
+    {
+        return ((uint64)(A & 0x1FFFFF) << 42) | ((uint64)(B & 0x1FFFFF) << 21) | (uint64)(C & 0x1FFFFF);
+    }
+
+    /** Calls Func for each trigram of an already lower-cased string. */
+    template<typename TFunc>
+    void ForEachTrigram(const FString& Lower, TFunc&& Func)
+    {
+        for (int32 i = 0; i + 2 < Lower.Len(); ++i)
+        {
+            Func(MakeTrigram(Lower[i], Lower[i + 1], Lower[i + 2]));
+        }
+    }
+}
+
+void FMCPAssetNameIndex::FData::Add(FEntry&& Entry)
+{
+    // In-memory assets are re-announced when saved; keep one entry per object path.
+    Remove(Entry.ObjectPath);
+
+    const int32 Index = Entries.Num();
+    ForEachTrigram(Entry.Name.ToLower(), [this, Index](uint64 Trigram)
+    {
+        // Indices only grow, so a repeated trigram within one name is always the last posting.
+        TArray<int32>& List = Postings.FindOrAdd(Trigram);
+        if (List.Num() == 0 || List.Last() != Index)
+        {
+            List.Add(Index);
+        }
+    });
+
+    EntryByPath.Add(Entry.ObjectPath, Index);
+    Entries.Add(MoveTemp(Entry));
+}
+
+void FMCPAssetNameIndex::FData::Remove(const FSoftObjectPath& ObjectPath)
+{
+    int32 Index = INDEX_NONE;
+    if (!EntryByPath.RemoveAndCopyValue(ObjectPath, Index))
+    {
+        return;
+    }
+
+    Entries[Index].bRemoved = true;
+    ++NumRemoved;
+    CompactIfNeeded();
+}
+
+void FMCPAssetNameIndex::FData::CompactIfNeeded()
+{
+    if (NumRemoved < MinRemovedBeforeCompact || NumRemoved * 4 < Entries.Num())
+    {
+        return;
+    }
+
+    TArray<FEntry> OldEntries = MoveTemp(Entries);
+    Entries.Reset(OldEntries.Num() - NumRemoved);
+    EntryByPath.Reset();
+    Postings.Reset();
+    NumRemoved = 0;
+
+    for (FEntry& Entry : OldEntries)
+    {
+        if (!Entry.bRemoved)
+        {
+            Add(MoveTemp(Entry));
+        }
+    }
+}
+
+FMCPAssetNameIndex& FMCPAssetNameIndex::Get()
+{
+    static FMCPAssetNameIndex Instance;
+    return Instance;
+}
+
+FMCPAssetNameIndex::FEntry FMCPAssetNameIndex::MakeEntry(const FAssetData& Asset)
+{
+    FEntry Entry;
+    Entry.Name = Asset.AssetName.ToString();
+    Entry.PackageName = Asset.PackageName;
+    Entry.ClassName = Asset.AssetClassPath.GetAssetName();
+    Entry.ObjectPath = Asset.GetSoftObjectPath();
+    return Entry;
+}
+
+void FMCPAssetNameIndex::Startup()
+{
+    check(IsInGameThread());
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+    if (AssetRegistry.IsLoadingAssets())
+    {
+        FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FMCPAssetNameIndex::BeginBuild);
+    }
+    else
+    {
+        BeginBuild();
+    }
+}
+
+void FMCPAssetNameIndex::Shutdown()
+{
+    check(IsInGameThread());
+
+    if (BuildTask.IsValid())
+    {
+        BuildTask.Wait();
+        BuildTask.Reset();
+    }
+
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+    {
+        IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+        AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+        AssetRegistry.OnAssetAdded().Remove(AddedHandle);
+        AssetRegistry.OnAssetRemoved().Remove(RemovedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(RenamedHandle);
+    }
+    FilesLoadedHandle.Reset();
+    AddedHandle.Reset();
+    RemovedHandle.Reset();
+    RenamedHandle.Reset();
+
+    FWriteScopeLock WriteLock(Lock);
+    Data = FData();
+    DeferredOps.Empty();
+    bReady = false;
+}
+
+void FMCPAssetNameIndex::BeginBuild()
+{
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+    AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+    FilesLoadedHandle.Reset();
+
+    // Subscribe before taking the snapshot; anything announced from here on is deferred until the build lands.
+    AddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FMCPAssetNameIndex::HandleAssetAdded);
+    RemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FMCPAssetNameIndex::HandleAssetRemoved);
+    RenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FMCPAssetNameIndex::HandleAssetRenamed);
+
+    TArray<FEntry> Entries;
+    {
+        TArray<FAssetData> Assets;
+        AssetRegistry.GetAllAssets(Assets, false);
+        Entries.Reserve(Assets.Num());
+        for (const FAssetData& Asset : Assets)
+        {
+            Entries.Add(MakeEntry(Asset));
+        }
+    }
+
+    // Building the postings for a large project takes a while; keep it off the game thread.
+    BuildTask = Async(EAsyncExecution::ThreadPool, [this, Entries = MoveTemp(Entries)]() mutable
+    {
+        FData NewData;
+        NewData.Entries.Reserve(Entries.Num());
+        for (FEntry& Entry : Entries)
+        {
+            NewData.Add(MoveTemp(Entry));
+        }
+
+        FWriteScopeLock WriteLock(Lock);
+        Data = MoveTemp(NewData);
+        for (TUniqueFunction<void(FData&)>& Op : DeferredOps)
+        {
+            Op(Data);
+        }
+        DeferredOps.Empty();
+        bReady = true;
+    });
+}
+
+void FMCPAssetNameIndex::ApplyOrDefer(TUniqueFunction<void(FData&)>&& Op)
+{
+    FWriteScopeLock WriteLock(Lock);
+    if (bReady)
+    {
+        Op(Data);
+    }
+    else
+    {
+        DeferredOps.Add(MoveTemp(Op));
+    }
+}
+
+void FMCPAssetNameIndex::HandleAssetAdded(const FAssetData& Asset)
+{
+    ApplyOrDefer([Entry = MakeEntry(Asset)](FData& InData) mutable
+    {
+        InData.Add(MoveTemp(Entry));
+    });
+}
+
+void FMCPAssetNameIndex::HandleAssetRemoved(const FAssetData& Asset)
+{
+    ApplyOrDefer([ObjectPath = Asset.GetSoftObjectPath()](FData& InData)
+    {
+        InData.Remove(ObjectPath);
+    });
+}
+
+void FMCPAssetNameIndex::HandleAssetRenamed(const FAssetData& Asset, const FString& OldObjectPath)
+{
+    ApplyOrDefer([Entry = MakeEntry(Asset), OldPath = FSoftObjectPath(OldObjectPath)](FData& InData) mutable
+    {
+        InData.Remove(OldPath);
+        InData.Add(MoveTemp(Entry));
+    });
+}
+
+bool FMCPAssetNameIndex::IsReady() const
+{
+    FReadScopeLock ReadLock(Lock);
+    return bReady;
+}
+
+int32 FMCPAssetNameIndex::Num() const
+{
+    FReadScopeLock ReadLock(Lock);
+    return Data.Entries.Num() - Data.NumRemoved;
+}
+
+bool FMCPAssetNameIndex::Query(TConstArrayView<FMCPCompiledPattern> Patterns, int32 Limit, TArray<FHit>& OutHits) const
+{
+    OutHits.Reset();
+
+    FReadScopeLock ReadLock(Lock);
+    if (!bReady)
+    {
+        return false;
+    }
+
+    // Candidates come from whichever pattern narrows furthest: per alternative, the posting list of its
+    // rarest trigram. Every candidate is then checked against all patterns.
+    TArray<const TArray<int32>*> Candidates;
+    bool bHaveCandidates = false;
+    int64 BestCount = MAX_int64;
+    for (const FMCPCompiledPattern& Pattern : Patterns)
+    {
+        TArray<TArray<FString>> Alternatives;
+        if (!Pattern.GetRequiredLiterals(Alternatives))
+        {
+            continue;
+        }
+
+        TArray<const TArray<int32>*> Lists;
+        int64 Count = 0;
+        bool bNarrows = true;
+        for (const TArray<FString>& Runs : Alternatives)
+        {
+            const TArray<int32>* Rarest = nullptr;
+            bool bHasTrigram = false;
+            bool bNoMatch = false;
+            for (const FString& Run : Runs)
+            {
+                ForEachTrigram(Run, [&](uint64 Trigram)
+                {
+                    bHasTrigram = true;
+                    const TArray<int32>* List = Data.Postings.Find(Trigram);
+                    if (!List)
+                    {
+                        bNoMatch = true;
+                    }
+                    else if (!Rarest || List->Num() < Rarest->Num())
+                    {
+                        Rarest = List;
+                    }
+                });
+            }
+
+            if (bNoMatch)
+            {
+                continue;  // This alternative can't match any asset
+            }
+            if (!bHasTrigram)
+            {
+                bNarrows = false;  // Too short to look up; a full scan is needed anyway
+                break;
+            }
+            Lists.Add(Rarest);
+            Count += Rarest->Num();
+        }
+
+        if (bNarrows && Count < BestCount)
+        {
+            BestCount = Count;
+            Candidates = MoveTemp(Lists);
+            bHaveCandidates = true;
+        }
+    }
+
+    auto TryAdd = [&](int32 Index) -> bool
+    {
+        const FEntry& Entry = Data.Entries[Index];
+        if (Entry.bRemoved)
+        {
+            return false;
+        }
+        for (const FMCPCompiledPattern& Pattern : Patterns)
+        {
+            if (!Pattern.Matches(Entry.Name))
+            {
+                return false;
+            }
+        }
+        OutHits.Add({ Entry.Name, Entry.PackageName, Entry.ClassName });
+        return OutHits.Num() >= Limit;
+    };
+
+    if (!bHaveCandidates)
+    {
+        for (int32 Index = 0; Index < Data.Entries.Num(); ++Index)
+        {
+            if (TryAdd(Index))
+            {
+                break;
+            }
+        }
+        return true;
+    }
+
+    // An asset can show up under several alternatives; only dedupe when there is more than one list.
+    TSet<int32> Seen;
+    for (const TArray<int32>* List : Candidates)
+    {
+        for (const int32 Index : *List)
+        {
+            if (Candidates.Num() > 1)
+            {
+                bool bAlreadySeen = false;
+                Seen.Add(Index, &bAlreadySeen);
+                if (bAlreadySeen)
+                {
+                    continue;
+                }
+            }
+            if (TryAdd(Index))
+            {
+                return true;
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "UObject/SoftObjectPath.h"
+#include "MCPSearchPatterns.h"
+
+struct FAssetData;
+
+/**
+ * In-memory index of asset names for find type=asset without class/path/tag filters.
+ * Built once the asset registry has finished its initial scan and kept current from the registry's
+ * added/removed/renamed events. Lower-case trigram postings narrow a glob or substring query to a few
+ * candidates, so queries never copy FAssetData and can run on any thread.
+ */
+class FMCPAssetNameIndex
+{
+public:
+    struct FHit
+    {
+        FString Name;
+        FName PackageName;
+        FName ClassName;
+    };
+
+    static FMCPAssetNameIndex& Get();
+
+    /** Game thread only. */
+    void Startup();
+    void Shutdown();
+
+    bool IsReady() const;
+    int32 Num() const;
+
+    /**
+     * Finds up to Limit assets whose name matches every pattern. Thread-safe.
+     * Returns false (and leaves OutHits empty) while the index is still being built.
+     */
+    bool Query(TConstArrayView<FMCPCompiledPattern> Patterns, int32 Limit, TArray<FHit>& OutHits) const;
+
+private:
+    struct FEntry
+    {
+        FString Name;
+        FName PackageName;
+        FName ClassName;
+        FSoftObjectPath ObjectPath;
+        bool bRemoved = false;
+    };
+
+    /** Everything guarded by Lock. Entries are append-only; removals are tombstones until the next compaction. */
+    struct FData
+    {
+        TArray<FEntry> Entries;
+        TMap<FSoftObjectPath, int32> EntryByPath;
+        TMap<uint64, TArray<int32>> Postings;
+        int32 NumRemoved = 0;
+
+        void Add(FEntry&& Entry);
+        void Remove(const FSoftObjectPath& ObjectPath);
+        void CompactIfNeeded();
+    };
+
+    static FEntry MakeEntry(const FAssetData& Asset);
+
+    void BeginBuild();
+    void HandleAssetAdded(const FAssetData& Asset);
+    void HandleAssetRemoved(const FAssetData& Asset);
+    void HandleAssetRenamed(const FAssetData& Asset, const FString& OldObjectPath);
+
+    /** Applies Op now, or after the background build if it is still running. */
+    void ApplyOrDefer(TUniqueFunction<void(FData&)>&& Op);
+
+    mutable FRWLock Lock;
+    FData Data;
+    bool bReady = false;
+    TArray<TUniqueFunction<void(FData&)>> DeferredOps;
+
+    TFuture<void> BuildTask;
+    FDelegateHandle FilesLoadedHandle;
+    FDelegateHandle AddedHandle;
+    FDelegateHandle RemovedHandle;
+    FDelegateHandle RenamedHandle;
+};
@@ -0,0 +1,198 @@
+#include "MCPClassIndex.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectIterator.h"
+
+FMCPClassIndex& FMCPClassIndex::Get()
+{
+    static FMCPClassIndex Instance;
+    return Instance;
+}
+
+UClass* FMCPClassIndex::FindClass(const FString& Name)
+{
+    check(IsInGameThread());
+
+    if (Name.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    // Paths are already a direct hash lookup; the index only helps with short names.
+    if (Name.Contains(TEXT("/")) || Name.Contains(TEXT(".")))
+    {
+        return FindFirstObject<UClass>(*Name, EFindFirstObjectOptions::EnsureIfAmbiguous);
+    }
+
+    EnsureBuilt();
+
+    // FNAME_Find never adds to the name table; a name that doesn't exist can't belong to a class.
+    const FName ShortName(*Name, FNAME_Find);
+    if (!ShortName.IsNone())
+    {
+        if (const FClassList* Classes = ByName.Find(ShortName))
+        {
+            for (const TWeakObjectPtr<UClass>& Weak : *Classes)
+            {
+                UClass* Class = Weak.Get();
+                if (IsValid(Class))
+                {
+                    return Class;
+                }
+            }
+        }
+    }
+
+    // A class created without one of the events above (e.g. loaded as a dependency) isn't indexed yet.
+    UClass* Found = FindFirstObject<UClass>(*Name, EFindFirstObjectOptions::None);
+    if (Found)
+    {
+        Invalidate();
+    }
+    return Found;
+}
+
+void FMCPClassIndex::GetDerivedClasses(UClass* Parent, TArray<UClass*>& OutClasses)
+{
+    check(IsInGameThread());
+
+    if (!Parent)
+    {
+        return;
+    }
+
+    EnsureBuilt();
+
+    TArray<UClass*, TInlineAllocator<64>> Stack;
+    Stack.Add(Parent);
+    while (Stack.Num() > 0)
+    {
+        UClass* Current = Stack.Pop();
+        const FClassList* Derived = Children.Find(Current);
+        if (!Derived)
+        {
+            continue;
+        }
+        for (const TWeakObjectPtr<UClass>& Weak : *Derived)
+        {
+            UClass* Child = Weak.Get();
+            // Re-check the parent; reinstancing can reparent a class without an event we track.
+            if (IsValid(Child) && Child->GetSuperClass() == Current)
+            {
+                OutClasses.Add(Child);
+                Stack.Add(Child);
+            }
+        }
+    }
+}
+
+int32 FMCPClassIndex::Num()
+{
+    check(IsInGameThread());
+    EnsureBuilt();
+    return NumClasses;
+}
+
+void FMCPClassIndex::Shutdown()
+{
+    if (bSubscribed)
+    {
+        FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+        FCoreUObjectDelegates::OnAssetLoaded.Remove(AssetLoadedHandle);
+        FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+        if (GEditor)
+        {
+            GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+            GEditor->OnBlueprintReinstanced().Remove(BlueprintReinstancedHandle);
+        }
+        bSubscribed = false;
+    }
+    Invalidate();
+}
+
+void FMCPClassIndex::EnsureBuilt()
+{
+    Subscribe();
+    if (bDirty)
+    {
+        Rebuild();
+    }
+}
+
+void FMCPClassIndex::Rebuild()
+{
+    Invalidate();
+
+    for (TObjectIterator<UClass> It; It; ++It)
+    {
+        UClass* Class = *It;
+        ByName.FindOrAdd(Class->GetFName()).Add(Class);
+        if (UClass* Super = Class->GetSuperClass())
+        {
+            Children.FindOrAdd(Super).Add(Class);
+        }
+        ++NumClasses;
+    }
+
+    // Native classes first, so an ambiguous short name resolves to the C++ class rather than a Blueprint copy.
+    for (TPair<FName, FClassList>& Pair : ByName)
+    {
+        if (Pair.Value.Num() > 1)
+        {
+            Pair.Value.StableSort([](const TWeakObjectPtr<UClass>& A, const TWeakObjectPtr<UClass>& B)
+            {
+                return A->HasAnyClassFlags(CLASS_Native) && !B->HasAnyClassFlags(CLASS_Native);
+            });
+        }
+    }
+
+    bDirty = false;
+}
+
+void FMCPClassIndex::Subscribe()
+{
+    // GEditor doesn't exist yet when the editor module starts, so hook up on first use.
+    if (bSubscribed || !GEditor)
+    {
+        return;
+    }
+
+    ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FMCPClassIndex::HandleReloadComplete);
+    AssetLoadedHandle = FCoreUObjectDelegates::OnAssetLoaded.AddRaw(this, &FMCPClassIndex::HandleAssetLoaded);
+    ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(this, &FMCPClassIndex::HandleModulesChanged);
+    BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FMCPClassIndex::Invalidate);
+    BlueprintReinstancedHandle = GEditor->OnBlueprintReinstanced().AddRaw(this, &FMCPClassIndex::Invalidate);
+    bSubscribed = true;
+}
+
+void FMCPClassIndex::Invalidate()
+{
+    bDirty = true;
+    NumClasses = 0;
+    ByName.Reset();
+    Children.Reset();
+}
+
+void FMCPClassIndex::HandleReloadComplete(EReloadCompleteReason Reason)
+{
+    Invalidate();
+}
+
+void FMCPClassIndex::HandleModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+    if (Reason == EModuleChangeReason::ModuleLoaded || Reason == EModuleChangeReason::ModuleUnloaded)
+    {
+        Invalidate();
+    }
+}
+
+void FMCPClassIndex::HandleAssetLoaded(UObject* Asset)
+{
+    // Rebuilding is lazy, so a burst of Blueprint loads costs one rebuild on the next query.
+    if (!bDirty && Asset && Asset->IsA<UBlueprint>())
+    {
+        Invalidate();
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+enum class EModuleChangeReason;
+enum class EReloadCompleteReason;
+
+/**
+ * Short-name lookup and parent -> children adjacency for every loaded UClass, so class resolution and
+ * find type=class don't go through the global object tables on each call. Built lazily and rebuilt after
+ * hot reload / Live Coding, Blueprint compiles, module loads and Blueprint asset loads. Game thread only.
+ */
+class FMCPClassIndex
+{
+public:
+    static FMCPClassIndex& Get();
+
+    /**
+     * Resolves a short class name ("StaticMeshActor") or a class path. Drop-in for
+     * FindFirstObject<UClass>; when a short name is ambiguous, native classes win.
+     */
+    UClass* FindClass(const FString& Name);
+
+    /** Appends every class derived from Parent, excluding Parent itself. */
+    void GetDerivedClasses(UClass* Parent, TArray<UClass*>& OutClasses);
+
+    /** Number of indexed classes, building the index if needed. */
+    int32 Num();
+
+    void Shutdown();
+
+private:
+    using FClassList = TArray<TWeakObjectPtr<UClass>, TInlineAllocator<1>>;
+
+    void EnsureBuilt();
+    void Rebuild();
+    void Subscribe();
+    void Invalidate();
+
+    void HandleReloadComplete(EReloadCompleteReason Reason);
+    void HandleModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+    void HandleAssetLoaded(UObject* Asset);
+
+    bool bDirty = true;
+    bool bSubscribed = false;
+    int32 NumClasses = 0;
+
+    /** FName comparison is case-insensitive, matching FindFirstObject. */
+    TMap<FName, FClassList> ByName;
+    TMap<TWeakObjectPtr<UClass>, FClassList> Children;
+
+    FDelegateHandle ReloadCompleteHandle;
+    FDelegateHandle BlueprintCompiledHandle;
+    FDelegateHandle BlueprintReinstancedHandle;
+    FDelegateHandle ModulesChangedHandle;
+    FDelegateHandle AssetLoadedHandle;
+};
@@ -1,4 +1,5 @@
 #include "MCPObjectResolver.h"
+#include "MCPActorIndex.h"
 #include "Editor.h"
 #include "Subsystems/EditorActorSubsystem.h"
 #include "Subsystems/EditorAssetSubsystem.h"
@@ -101,32 +102,9 @@ AActor* FMCPObjectResolver::ResolveActor(const FString& Target, FString& OutErro
         return nullptr;
     }
 
-    TArray<AActor*> AllActors = ActorSubsystem->GetAllLevelActors();
-
-    // First pass: match by label (case-insensitive)
-    for (AActor* Actor : AllActors)
-    {
-        if (!Actor)
-        {
-            continue;
-        }
-        if (Actor->GetActorLabel().Equals(Target, ESearchCase::IgnoreCase))
-        {
-            return Actor;
-        }
-    }
-
-    // Second pass: match by internal name
-    for (AActor* Actor : AllActors)
+    if (AActor* Actor = FMCPActorIndex::Get().Find(Target))
     {
-        if (!Actor)
-        {
-            continue;
-        }
-        if (Actor->GetName().Equals(Target, ESearchCase::IgnoreCase))
-        {
-            return Actor;
-        }
+        return Actor;
     }
 
     OutError = FString::Printf(TEXT("Actor '%s' not found"), *Target);
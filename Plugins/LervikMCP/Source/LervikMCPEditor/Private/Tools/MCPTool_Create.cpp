@@ -3,6 +3,8 @@
 #include "MCPJsonHelpers.h"
 #include "MCPToolHelp.h"
 #include "MCPObjectResolver.h"
+#include "MCPClassIndex.h"
+#include "MCPActorIndex.h"
 #include "MCPPropertyHelpers.h"
 
 #include "IAssetTools.h"
@@ -80,12 +82,17 @@ FMCPToolInfo FMCPTool_Create::GetToolInfo() const
 }
 
 FMCPToolResult FMCPTool_Create::Execute(const TSharedPtr<FJsonObject>& Params)
+{
+    return ExecuteAsync(Params, FMCPToolContext()).Get();
+}
+
+TFuture<FMCPToolResult> FMCPTool_Create::ExecuteAsync(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context)
 {
     FMCPToolResult HelpResult;
     if (MCPToolHelp::CheckAndHandleHelp(Params, sCreateHelp, HelpResult))
-        return HelpResult;
+        return MakeFulfilledPromise<FMCPToolResult>(MoveTemp(HelpResult)).GetFuture();
 
-    return ExecuteOnGameThread([Params]() -> FMCPToolResult
+    return ExecuteOnGameThreadAsync(Context, [Params]() -> FMCPToolResult
     {
         FString Type;
         if (!Params->TryGetStringField(TEXT("type"), Type))
@@ -154,7 +161,7 @@ FMCPToolResult FMCPTool_Create::Execute(const TSharedPtr<FJsonObject>& Params)
                 UClass* ResolvedParent = AActor::StaticClass();
                 if (!ParentClassName.IsEmpty())
                 {
-                    UClass* Found = FindFirstObject<UClass>(*ParentClassName, EFindFirstObjectOptions::EnsureIfAmbiguous);
+                    UClass* Found = FMCPClassIndex::Get().FindClass(ParentClassName);
                     if (Found)
                     {
                         ResolvedParent = Found;
@@ -231,7 +238,7 @@ FMCPToolResult FMCPTool_Create::Execute(const TSharedPtr<FJsonObject>& Params)
                 {
                     return FMCPToolResult::Error(TEXT("'class' is required for actor creation without a template"));
                 }
-                UClass* ActorClass = FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::EnsureIfAmbiguous);
+                UClass* ActorClass = FMCPClassIndex::Get().FindClass(ClassName);
                 if (!ActorClass)
                 {
                     return FMCPToolResult::Error(FString::Printf(TEXT("Class '%s' not found"), *ClassName));
@@ -267,6 +274,9 @@ FMCPToolResult FMCPTool_Create::Execute(const TSharedPtr<FJsonObject>& Params)
                 NewActor->PostEditChange();
             }
 
+            // The index saw the actor at its spawn transform; template placement, scale and properties came later.
+            FMCPActorIndex::Get().NotifyActorMoved(NewActor);
+
             FVector Loc = NewActor->GetActorLocation();
             TSharedPtr<FJsonObject> LocObj = MakeShared<FJsonObject>();
             LocObj->SetField(TEXT("x"), FMCPJsonHelpers::RoundedJsonNumber(Loc.X));
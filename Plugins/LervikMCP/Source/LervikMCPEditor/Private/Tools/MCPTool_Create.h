@@ -7,4 +7,5 @@ class FMCPTool_Create : public IMCPTool
 public:
     virtual FMCPToolInfo GetToolInfo() const override;
     virtual FMCPToolResult Execute(const TSharedPtr<FJsonObject>& Params) override;
+    virtual TFuture<FMCPToolResult> ExecuteAsync(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context) override;
 };
@@ -135,12 +135,17 @@ FMCPToolInfo FMCPTool_Delete::GetToolInfo() const
 }
 
 FMCPToolResult FMCPTool_Delete::Execute(const TSharedPtr<FJsonObject>& Params)
+{
+    return ExecuteAsync(Params, FMCPToolContext()).Get();
+}
+
+TFuture<FMCPToolResult> FMCPTool_Delete::ExecuteAsync(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context)
 {
     FMCPToolResult HelpResult;
     if (MCPToolHelp::CheckAndHandleHelp(Params, sDeleteHelp, HelpResult))
-        return HelpResult;
+        return MakeFulfilledPromise<FMCPToolResult>(MoveTemp(HelpResult)).GetFuture();
 
-    return ExecuteOnGameThread([Params]() -> FMCPToolResult
+    return ExecuteOnGameThreadAsync(Context, [Params]() -> FMCPToolResult
     {
         FString Type;
         if (!Params->TryGetStringField(TEXT("type"), Type))
@@ -85,12 +85,17 @@ FMCPToolInfo FMCPTool_Editor::GetToolInfo() const
 }
 
 FMCPToolResult FMCPTool_Editor::Execute(const TSharedPtr<FJsonObject>& Params)
+{
+    return ExecuteAsync(Params, FMCPToolContext()).Get();
+}
+
+TFuture<FMCPToolResult> FMCPTool_Editor::ExecuteAsync(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context)
 {
     FMCPToolResult HelpResult;
     if (MCPToolHelp::CheckAndHandleHelp(Params, sEditorHelp, HelpResult))
-        return HelpResult;
+        return MakeFulfilledPromise<FMCPToolResult>(MoveTemp(HelpResult)).GetFuture();
 
-    return ExecuteOnGameThread([Params]() -> FMCPToolResult
+    return ExecuteOnGameThreadAsync(Context, [Params]() -> FMCPToolResult
     {
         FString Action;
         if (!Params->TryGetStringField(TEXT("action"), Action))
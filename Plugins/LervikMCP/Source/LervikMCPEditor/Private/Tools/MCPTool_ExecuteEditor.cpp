@@ -2,6 +2,7 @@
 #include "MCPGameThreadHelper.h"
 #include "MCPJsonHelpers.h"
 #include "MCPToolHelp.h"
+#include "MCPActorIndex.h"
 #include "Editor.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
@@ -82,21 +83,21 @@ FMCPToolInfo FMCPTool_ExecuteEditor::GetToolInfo() const
     return Info;
 }
 
-FMCPToolResult FMCPTool_ExecuteEditor::Execute(const TSharedPtr<FJsonObject>& Params)
+TFuture<FMCPToolResult> FMCPTool_ExecuteEditor::ExecuteAsync(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context)
 {
     FMCPToolResult HelpResult;
     if (MCPToolHelp::CheckAndHandleHelp(Params, sExecEditorHelp, HelpResult))
-        return HelpResult;
+        return MakeFulfilledPromise<FMCPToolResult>(MoveTemp(HelpResult)).GetFuture();
 
     FString Action;
     if (!Params->TryGetStringField(TEXT("action"), Action))
     {
-        return FMCPToolResult::Error(TEXT("'action' is required"));
+        return MakeFulfilledPromise<FMCPToolResult>(FMCPToolResult::Error(TEXT("'action' is required"))).GetFuture();
     }
 
     if (Action.Equals(TEXT("command"), ESearchCase::IgnoreCase))
     {
-        return ExecuteOnGameThread([Params]() -> FMCPToolResult
+        return ExecuteOnGameThreadAsync(Context, [Params]() -> FMCPToolResult
         {
             FString Command;
             if (!Params->TryGetStringField(TEXT("command"), Command))
@@ -120,6 +121,8 @@ FMCPToolResult FMCPTool_ExecuteEditor::Execute(const TSharedPtr<FJsonObject>& Pa
             GLog->AddOutputDevice(&OutputDevice);
             GEditor->Exec(World, *Command, OutputDevice);
             GLog->RemoveOutputDevice(&OutputDevice);
+            // Console commands can move or rename actors without firing the events the index listens to
+            FMCPActorIndex::Get().Invalidate();
 
             TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
             Result->SetStringField(TEXT("command"), Command);
@@ -129,5 +132,5 @@ FMCPToolResult FMCPTool_ExecuteEditor::Execute(const TSharedPtr<FJsonObject>& Pa
     }
 
     // Delegate all other actions to the runtime base class
-    return FMCPTool_Execute::Execute(Params);
+    return FMCPTool_Execute::ExecuteAsync(Params, Context);
 }
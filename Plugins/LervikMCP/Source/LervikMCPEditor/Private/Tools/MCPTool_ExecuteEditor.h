@@ -6,5 +6,5 @@ class FMCPTool_ExecuteEditor : public FMCPTool_Execute
 {
 public:
     virtual FMCPToolInfo GetToolInfo() const override;
-    virtual FMCPToolResult Execute(const TSharedPtr<FJsonObject>& Params) override;
+    virtual TFuture<FMCPToolResult> ExecuteAsync(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context) override;
 };
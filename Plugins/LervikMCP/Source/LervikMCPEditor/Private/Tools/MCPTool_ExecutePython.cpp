@@ -2,6 +2,7 @@
 #include "MCPGameThreadHelper.h"
 #include "MCPJsonHelpers.h"
 #include "MCPGraphHelpers.h"
+#include "MCPActorIndex.h"
 #include "MCPPythonValidator.h"
 #include "MCPToolHelp.h"
 
@@ -44,12 +45,17 @@ FMCPToolInfo FMCPTool_ExecutePython::GetToolInfo() const
 }
 
 FMCPToolResult FMCPTool_ExecutePython::Execute(const TSharedPtr<FJsonObject>& Params)
+{
+    return ExecuteAsync(Params, FMCPToolContext()).Get();
+}
+
+TFuture<FMCPToolResult> FMCPTool_ExecutePython::ExecuteAsync(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context)
 {
     FMCPToolResult HelpResult;
     if (MCPToolHelp::CheckAndHandleHelp(Params, sExecPythonHelp, HelpResult))
-        return HelpResult;
+        return MakeFulfilledPromise<FMCPToolResult>(MoveTemp(HelpResult)).GetFuture();
 
-    return ExecuteOnGameThread([Params]() -> FMCPToolResult
+    return ExecuteOnGameThreadAsync(Context, [Params]() -> FMCPToolResult
     {
         // 1. Extract and validate "code"
         FString Code;
@@ -101,6 +107,8 @@ FMCPToolResult FMCPTool_ExecutePython::Execute(const TSharedPtr<FJsonObject>& Pa
 
         // Refresh any open Material/Blueprint editors (partial modifications may have occurred)
         FMCPGraphHelpers::RefreshAllOpenEditors();
+        // Scripts move actors with set_actor_location and friends, which fire no event the index hears
+        FMCPActorIndex::Get().Invalidate();
 
         // 7. Collect output
         TArray<TSharedPtr<FJsonValue>> OutputLines;
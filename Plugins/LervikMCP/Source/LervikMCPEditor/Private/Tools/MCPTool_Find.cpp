@@ -2,8 +2,12 @@
 #include "MCPGameThreadHelper.h"
 #include "MCPJsonHelpers.h"
 #include "MCPSearchPatterns.h"
+#include "MCPResultPages.h"
 #include "MCPToolHelp.h"
 #include "MCPObjectResolver.h"
+#include "MCPClassIndex.h"
+#include "MCPAssetNameIndex.h"
+#include "MCPActorIndex.h"
 
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetRegistry/IAssetRegistry.h"
@@ -11,6 +15,11 @@
 #include "UObject/UObjectIterator.h"
 #include "GameFramework/Actor.h"
 #include "Editor.h"
+#include "LevelEditorViewport.h"
+#include "ConvexVolume.h"
+#include "Math/PerspectiveMatrix.h"
+#include "Math/RotationMatrix.h"
+#include "Math/TranslationMatrix.h"
 
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
@@ -33,12 +42,215 @@ namespace
         return Obj;
     }
 
-    FMCPToolResult MakeListResult(TArray<TSharedPtr<FJsonValue>>& Items)
+    /** Spatial constraints for find type=actor. Every constraint that is set must hold. */
+    struct FActorSpatialQuery
     {
-        TSharedPtr<FJsonObject> Res = MakeShared<FJsonObject>();
-        Res->SetArrayField(TEXT("results"), Items);
-        Res->SetNumberField(TEXT("count"), Items.Num());
-        return FMCPJsonHelpers::SuccessResponse(Res);
+        TOptional<FSphere> Near;
+        TOptional<FBox> Box;
+        TOptional<FConvexVolume> Frustum;
+        /** Results are sorted by distance from here: the near point, else the box center, else the camera. */
+        FVector Origin = FVector::ZeroVector;
+
+        bool IsSet() const
+        {
+            return Near.IsSet() || Box.IsSet() || Frustum.IsSet();
+        }
+
+        bool Contains(const FBoxCenterAndExtent& Bounds) const
+        {
+            const FBox ActorBox = Bounds.GetBox();
+            if (Near && ActorBox.ComputeSquaredDistanceToPoint(Near->Center) > FMath::Square(Near->W)) return false;
+            if (Box && !Box->Intersect(ActorBox)) return false;
+            if (Frustum && !Frustum->IntersectBox(ActorBox.GetCenter(), ActorBox.GetExtent())) return false;
+            return true;
+        }
+    };
+
+    /** View frustum of the active perspective level viewport, or the first visible perspective one. */
+    bool TryGetViewportFrustum(FConvexVolume& OutFrustum, FVector& OutViewLocation, FString& OutError)
+    {
+        FLevelEditorViewportClient* Client = GCurrentLevelEditingViewportClient;
+        auto IsUsable = [](const FLevelEditorViewportClient* Candidate)
+        {
+            return Candidate && Candidate->IsPerspective() && Candidate->Viewport
+                && Candidate->Viewport->GetSizeXY().X > 0 && Candidate->Viewport->GetSizeXY().Y > 0;
+        };
+        if (!IsUsable(Client))
+        {
+            Client = nullptr;
+            for (FLevelEditorViewportClient* Candidate : GEditor->GetLevelViewportClients())
+            {
+                if (IsUsable(Candidate))
+                {
+                    Client = Candidate;
+                    break;
+                }
+            }
+        }
+        if (!Client)
+        {
+            OutError = TEXT("'in_view' needs a visible perspective level viewport");
+            return false;
+        }
+
+        const FIntPoint Size = Client->Viewport->GetSizeXY();
+        OutViewLocation = Client->GetViewLocation();
+
+        // Same view/projection setup as the editor's scene view: UE's X-forward basis swizzled to
+        // Z-forward, and a reversed-Z projection from the horizontal FOV.
+        const FMatrix ViewMatrix = FTranslationMatrix(-OutViewLocation)
+            * FInverseRotationMatrix(Client->GetViewRotation())
+            * FMatrix(FPlane(0, 0, 1, 0), FPlane(1, 0, 0, 0), FPlane(0, 1, 0, 0), FPlane(0, 0, 0, 1));
+        const FMatrix ProjectionMatrix = FReversedZPerspectiveMatrix(
+            FMath::DegreesToRadians(Client->ViewFOV) * 0.5f, Size.X, Size.Y, Client->GetNearClipPlane());
+
+        GetViewFrustumBounds(OutFrustum, ViewMatrix * ProjectionMatrix, false);
+        return true;
+    }
+
+    /** Reads near/radius, box and in_view. Returns false with OutError set if one of them is malformed. */
+    bool ParseActorSpatialQuery(const TSharedPtr<FJsonObject>& Params, FActorSpatialQuery& OutQuery, FString& OutError)
+    {
+        if (Params->HasField(TEXT("near")))
+        {
+            FVector Center;
+            FString NearActor;
+            if (Params->TryGetStringField(TEXT("near"), NearActor))
+            {
+                AActor* Actor = FMCPObjectResolver::ResolveActor(NearActor, OutError);
+                if (!Actor) return false;
+                Center = Actor->GetActorLocation();
+            }
+            else if (!FMCPJsonHelpers::TryParseVector(Params, TEXT("near"), Center))
+            {
+                OutError = TEXT("'near' must be [x,y,z], {x,y,z} or an actor label");
+                return false;
+            }
+
+            double Radius = 1000.0;
+            Params->TryGetNumberField(TEXT("radius"), Radius);
+            if (Radius < 0.0)
+            {
+                OutError = TEXT("'radius' must be >= 0");
+                return false;
+            }
+            OutQuery.Near = FSphere(Center, Radius);
+        }
+
+        const TSharedPtr<FJsonObject>* BoxObj = nullptr;
+        if (Params->TryGetObjectField(TEXT("box"), BoxObj))
+        {
+            FVector Min, Max;
+            if (!FMCPJsonHelpers::TryParseVector(*BoxObj, TEXT("min"), Min) || !FMCPJsonHelpers::TryParseVector(*BoxObj, TEXT("max"), Max))
+            {
+                OutError = TEXT("'box' must be {\"min\": [x,y,z], \"max\": [x,y,z]}");
+                return false;
+            }
+            OutQuery.Box = FBox(Min.ComponentMin(Max), Min.ComponentMax(Max));
+        }
+
+        bool bInView = false;
+        FVector ViewLocation = FVector::ZeroVector;
+        if (Params->TryGetBoolField(TEXT("in_view"), bInView) && bInView)
+        {
+            FConvexVolume Frustum;
+            if (!TryGetViewportFrustum(Frustum, ViewLocation, OutError)) return false;
+            OutQuery.Frustum = MoveTemp(Frustum);
+        }
+
+        OutQuery.Origin = OutQuery.Near ? OutQuery.Near->Center
+            : OutQuery.Box ? OutQuery.Box->GetCenter()
+            : ViewLocation;
+        return true;
+    }
+
+    TSharedPtr<FJsonValue> MakeAssetJson(const FString& Name, FName PackageName, FName ClassName)
+    {
+        TSharedPtr<FJsonObject> AssetObj = MakeShared<FJsonObject>();
+        AssetObj->SetStringField(TEXT("name"),  Name);
+        AssetObj->SetStringField(TEXT("path"),  PackageName.ToString());
+        AssetObj->SetStringField(TEXT("class"), ClassName.ToString());
+        return MakeShared<FJsonValueObject>(AssetObj);
+    }
+
+    TSharedPtr<FJsonValue> MakeActorJsonValue(const TWeakObjectPtr<AActor>& WeakActor)
+    {
+        AActor* Actor = WeakActor.Get();
+        if (!Actor)
+        {
+            return nullptr;
+        }
+        return MakeShared<FJsonValueObject>(MakeActorJson(Actor));
+    }
+
+    /**
+     * Returns the first Limit items; the rest are served through "next_cursor". Handles are kept as they are
+     * and WriteItem turns one into JSON only when its page is returned.
+     */
+    template<typename THandle, typename TWriter>
+    FMCPToolResult MakeListResult(const FMCPToolContext& Context, TArray<THandle>&& Handles, bool bTruncated, int32 Limit,
+        bool bWriteOnGameThread, TWriter&& WriteItem)
+    {
+        FMCPResultList List = FMCPResultList::FromHandles(TEXT("results"), MoveTemp(Handles), Forward<TWriter>(WriteItem));
+        List.bTruncated = bTruncated;
+        List.bWriteOnGameThread = bWriteOnGameThread;
+        return FMCPResultPages::Get().MakeFirstPage(Context, TEXT("find"), MoveTemp(List), Limit);
+    }
+
+    /** Adds Handle unless MaxItems handles are already collected; then sets bTruncated and returns false. */
+    template<typename THandle>
+    bool AddHandle(TArray<THandle>& Handles, THandle&& Handle, bool& bTruncated)
+    {
+        if (Handles.Num() >= FMCPResultPages::MaxItems)
+        {
+            bTruncated = true;
+            return false;
+        }
+        Handles.Add(MoveTemp(Handle));
+        return true;
+    }
+
+    /**
+     * find type=asset without class/path/tag filters, answered from the asset name index on the calling
+     * thread. Returns false when the request needs the registry or the index is still being built.
+     */
+    bool TryFindAssetsInIndex(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context, FMCPToolResult& OutResult)
+    {
+        FString Type, ClassName, PathStr, TagStr, NameFilter, FilterStr;
+        double LimitD = 100.0;
+        if (!Params->TryGetStringField(TEXT("type"), Type) || !Type.Equals(TEXT("asset"), ESearchCase::IgnoreCase))
+        {
+            return false;
+        }
+        Params->TryGetStringField(TEXT("class"), ClassName);
+        Params->TryGetStringField(TEXT("path"),  PathStr);
+        Params->TryGetStringField(TEXT("tag"),   TagStr);
+        if (!ClassName.IsEmpty() || !PathStr.IsEmpty() || !TagStr.IsEmpty())
+        {
+            return false;
+        }
+        Params->TryGetStringField(TEXT("name"),   NameFilter);
+        Params->TryGetStringField(TEXT("filter"), FilterStr);
+        Params->TryGetNumberField(TEXT("limit"),  LimitD);
+
+        const int32 Limit = FMath::Max(1, FMath::FloorToInt(LimitD));
+        const FMCPCompiledPattern Patterns[] = { FMCPSearchPatterns::Compile(NameFilter), FMCPSearchPatterns::Compile(FilterStr) };
+
+        // One hit past the cap tells whether there were more.
+        TArray<FMCPAssetNameIndex::FHit> Hits;
+        if (!FMCPAssetNameIndex::Get().Query(Patterns, FMCPResultPages::MaxItems + 1, Hits))
+        {
+            return false;
+        }
+        const bool bTruncated = Hits.Num() > FMCPResultPages::MaxItems;
+        Hits.SetNum(FMath::Min(Hits.Num(), FMCPResultPages::MaxItems));
+
+        // Hits are plain values, so later pages are written on the calling thread as well.
+        OutResult = MakeListResult(Context, MoveTemp(Hits), bTruncated, Limit, false, [](const FMCPAssetNameIndex::FHit& Hit)
+        {
+            return MakeAssetJson(Hit.Name, Hit.PackageName, Hit.ClassName);
+        });
+        return true;
     }
 
     // ── Help data ────────────────────────────────────────────────────────
@@ -50,21 +262,28 @@ namespace
         { TEXT("tag"),       TEXT("string"),  false, TEXT("Asset registry tag filter. Format: tag_name=value"), nullptr, nullptr },
         { TEXT("filter"),    TEXT("string"),  false, TEXT("Post-filter glob/regex on result names"), nullptr, nullptr },
         { TEXT("recursive"), TEXT("boolean"), false, TEXT("Search recursively. Default: true"), nullptr, nullptr },
-        { TEXT("limit"),     TEXT("integer"), false, TEXT("Max results. Default: 100"), nullptr, nullptr },
+        { TEXT("limit"),     TEXT("integer"), false, TEXT("Page size. Default: 100"), nullptr, nullptr },
+        { TEXT("cursor"),    TEXT("string"),  false, TEXT("next_cursor from a previous page; other params are ignored"), nullptr, nullptr },
     };
 
     static const FMCPParamHelp sFindActorParams[] = {
         { TEXT("class"),  TEXT("string"),  false, TEXT("Actor class filter (wildcards supported)"), nullptr, TEXT("PointLight") },
         { TEXT("name"),   TEXT("string"),  false, TEXT("Name/label filter (wildcards supported)"), nullptr, nullptr },
         { TEXT("filter"), TEXT("string"),  false, TEXT("Post-filter glob/regex on result names"), nullptr, nullptr },
-        { TEXT("limit"),  TEXT("integer"), false, TEXT("Max results. Default: 100"), nullptr, nullptr },
+        { TEXT("near"),    TEXT("string|array"),   false, TEXT("Point [x,y,z] or actor label. Keeps actors whose bounds are within 'radius'"), nullptr, TEXT("PlayerStart") },
+        { TEXT("radius"),  TEXT("number"),  false, TEXT("Radius for 'near' in cm. Default: 1000"), nullptr, TEXT("1000") },
+        { TEXT("box"),     TEXT("object"),  false, TEXT("Keeps actors whose bounds intersect {\"min\": [x,y,z], \"max\": [x,y,z]}"), nullptr, nullptr },
+        { TEXT("in_view"), TEXT("boolean"), false, TEXT("Keeps actors inside the active perspective viewport's frustum"), nullptr, nullptr },
+        { TEXT("limit"),  TEXT("integer"), false, TEXT("Page size. Default: 100"), nullptr, nullptr },
+        { TEXT("cursor"), TEXT("string"),  false, TEXT("next_cursor from a previous page; other params are ignored"), nullptr, nullptr },
     };
 
     static const FMCPParamHelp sFindClassParams[] = {
         { TEXT("parent"), TEXT("string"),  false, TEXT("Parent class name for derived class search"), nullptr, TEXT("Actor") },
         { TEXT("name"),   TEXT("string"),  false, TEXT("Name filter (wildcards supported)"), nullptr, nullptr },
         { TEXT("filter"), TEXT("string"),  false, TEXT("Post-filter glob/regex on result names"), nullptr, nullptr },
-        { TEXT("limit"),  TEXT("integer"), false, TEXT("Max results. Default: 100"), nullptr, nullptr },
+        { TEXT("limit"),  TEXT("integer"), false, TEXT("Page size. Default: 100"), nullptr, nullptr },
+        { TEXT("cursor"), TEXT("string"),  false, TEXT("next_cursor from a previous page; other params are ignored"), nullptr, nullptr },
     };
 
     static const FMCPParamHelp sFindPropertyParams[] = {
@@ -108,19 +327,37 @@ FMCPToolInfo FMCPTool_Find::GetToolInfo() const
         { TEXT("target"),    TEXT("[property] Object path to list UProperty names. For BP user variables use inspect type=variables"), TEXT("string"),  false },
         { TEXT("filter"),    TEXT("Post-filter glob/regex on result names"),                                               TEXT("string"),  false },
         { TEXT("recursive"), TEXT("[asset] Search recursively. Default: true"),                                            TEXT("boolean"), false },
-        { TEXT("limit"),     TEXT("Max results. Default: 100"),                                                            TEXT("integer"), false },
+        { TEXT("near"),      TEXT("[actor] Point [x,y,z] or actor label; keeps actors within 'radius'. Results sort by distance"), TEXT("string|array|object"), false, TEXT("number") },
+        { TEXT("radius"),    TEXT("[actor] Radius for 'near' in cm. Default: 1000"),                                        TEXT("number"),  false },
+        { TEXT("box"),       TEXT("[actor] {\"min\": [x,y,z], \"max\": [x,y,z]}; keeps actors whose bounds intersect it"),   TEXT("object"),  false },
+        { TEXT("in_view"),   TEXT("[actor] Keep actors inside the active perspective viewport's frustum (see get_viewport_info)"), TEXT("boolean"), false },
+        { TEXT("limit"),     TEXT("Page size. Default: 100. Results past it are returned with a next_cursor"),            TEXT("integer"), false },
+        { TEXT("cursor"),    TEXT("next_cursor from a previous page. Serves the next page without re-running the query"), TEXT("string"),  false },
         { TEXT("help"),      TEXT("Pass help=true for overview, help='type_name' for detailed parameter info"), TEXT("string"), false },
     };
     return Info;
 }
 
 FMCPToolResult FMCPTool_Find::Execute(const TSharedPtr<FJsonObject>& Params)
+{
+    return ExecuteAsync(Params, FMCPToolContext()).Get();
+}
+
+TFuture<FMCPToolResult> FMCPTool_Find::ExecuteAsync(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context)
 {
     FMCPToolResult HelpResult;
     if (MCPToolHelp::CheckAndHandleHelp(Params, sFindHelp, HelpResult))
-        return HelpResult;
+        return MakeFulfilledPromise<FMCPToolResult>(MoveTemp(HelpResult)).GetFuture();
+
+    TFuture<FMCPToolResult> PageResult;
+    if (FMCPResultPages::Get().TryServeCursor(Params, Context, TEXT("find"), PageResult))
+        return PageResult;
+
+    FMCPToolResult IndexResult;
+    if (TryFindAssetsInIndex(Params, Context, IndexResult))
+        return MakeFulfilledPromise<FMCPToolResult>(MoveTemp(IndexResult)).GetFuture();
 
-    return ExecuteOnGameThread([Params]() -> FMCPToolResult
+    return ExecuteOnGameThreadAsync(Context, [Params, Context]() -> FMCPToolResult
     {
         FString Type;
         if (!Params->TryGetStringField(TEXT("type"), Type))
@@ -144,10 +381,14 @@ FMCPToolResult FMCPTool_Find::Execute(const TSharedPtr<FJsonObject>& Params)
 
         const int32 Limit = FMath::Max(1, FMath::FloorToInt(LimitD));
 
+        // Compiled once per request; the loops below match them against every candidate.
+        const FMCPCompiledPattern NamePattern   = FMCPSearchPatterns::Compile(NameFilter);
+        const FMCPCompiledPattern FilterPattern = FMCPSearchPatterns::Compile(FilterStr);
+        const FMCPCompiledPattern ClassPattern  = FMCPSearchPatterns::Compile(ClassName);
+
         auto PassesFilters = [&](const FString& Name) -> bool
         {
-            return (NameFilter.IsEmpty() || FMCPSearchPatterns::Matches(NameFilter, Name))
-                && (FilterStr.IsEmpty()  || FMCPSearchPatterns::Matches(FilterStr,  Name));
+            return NamePattern.Matches(Name) && FilterPattern.Matches(Name);
         };
 
         // ── type=asset ──────────────────────────────────────────────────────
@@ -166,7 +407,7 @@ FMCPToolResult FMCPTool_Find::Execute(const TSharedPtr<FJsonObject>& Params)
             if (!ClassName.IsEmpty())
             {
                 ARFilter.bRecursiveClasses = true;
-                UClass* FoundClass = FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::EnsureIfAmbiguous);
+                UClass* FoundClass = FMCPClassIndex::Get().FindClass(ClassName);
                 if (FoundClass)
                 {
                     ARFilter.ClassPaths.Add(FoundClass->GetClassPathName());
@@ -198,20 +439,19 @@ FMCPToolResult FMCPTool_Find::Execute(const TSharedPtr<FJsonObject>& Params)
                 AssetRegistry.GetAssets(ARFilter, Assets);
             }
 
-            TArray<TSharedPtr<FJsonValue>> Results;
-            for (const FAssetData& Asset : Assets)
+            TArray<FAssetData> Matches;
+            bool bTruncated = false;
+            for (FAssetData& Asset : Assets)
             {
                 if (!PassesFilters(Asset.AssetName.ToString())) continue;
-
-                TSharedPtr<FJsonObject> AssetObj = MakeShared<FJsonObject>();
-                AssetObj->SetStringField(TEXT("name"),  Asset.AssetName.ToString());
-                AssetObj->SetStringField(TEXT("path"),  Asset.PackageName.ToString());
-                AssetObj->SetStringField(TEXT("class"), Asset.AssetClassPath.GetAssetName().ToString());
-                Results.Add(MakeShared<FJsonValueObject>(AssetObj));
-
-                if (Results.Num() >= Limit) break;
+                if (!AddHandle(Matches, MoveTemp(Asset), bTruncated)) break;
             }
-            return MakeListResult(Results);
+
+            // FAssetData is a plain value, so later pages don't need the game thread.
+            return MakeListResult(Context, MoveTemp(Matches), bTruncated, Limit, false, [](const FAssetData& Asset)
+            {
+                return MakeAssetJson(Asset.AssetName.ToString(), Asset.PackageName, Asset.AssetClassPath.GetAssetName());
+            });
         }
 
         // ── type=actor ──────────────────────────────────────────────────────
@@ -227,17 +467,70 @@ FMCPToolResult FMCPTool_Find::Execute(const TSharedPtr<FJsonObject>& Params)
                 return FMCPToolResult::Error(TEXT("EditorActorSubsystem not available"));
             }
 
-            TArray<TSharedPtr<FJsonValue>> Results;
-            for (AActor* Actor : ActorSub->GetAllLevelActors())
+            FActorSpatialQuery Spatial;
+            FString SpatialError;
+            if (!ParseActorSpatialQuery(Params, Spatial, SpatialError))
             {
-                if (!Actor) continue;
-                if (!ClassName.IsEmpty() && !FMCPSearchPatterns::Matches(ClassName, Actor->GetClass()->GetName())) continue;
-                if (!PassesFilters(Actor->GetActorLabel())) continue;
+                return FMCPToolResult::Error(SpatialError);
+            }
+
+            if (!Spatial.IsSet())
+            {
+                TArray<TWeakObjectPtr<AActor>> Matches;
+                bool bTruncated = false;
+                for (AActor* Actor : ActorSub->GetAllLevelActors())
+                {
+                    if (!Actor) continue;
+                    if (!ClassPattern.Matches(Actor->GetClass()->GetName())) continue;
+                    if (!PassesFilters(Actor->GetActorLabel())) continue;
+                    if (!AddHandle(Matches, TWeakObjectPtr<AActor>(Actor), bTruncated)) break;
+                }
+                return MakeListResult(Context, MoveTemp(Matches), bTruncated, Limit, true, &MakeActorJsonValue);
+            }
 
-                Results.Add(MakeShared<FJsonValueObject>(MakeActorJson(Actor)));
-                if (Results.Num() >= Limit) break;
+            // The octree narrows to candidates by indexed bounds; each one is re-tested against its live bounds.
+            TArray<TPair<double, AActor*>> Hits;
+            auto Visit = [&](AActor* Actor)
+            {
+                if (!ClassPattern.Matches(Actor->GetClass()->GetName())) return;
+                if (!PassesFilters(Actor->GetActorLabel())) return;
+                if (!Spatial.Contains(FMCPActorIndex::GetActorQueryBounds(Actor))) return;
+                Hits.Emplace(FVector::Dist(Spatial.Origin, Actor->GetActorLocation()), Actor);
+            };
+
+            FMCPActorIndex& ActorIndex = FMCPActorIndex::Get();
+            if (Spatial.Near)
+            {
+                const FVector Radius(Spatial.Near->W);
+                ActorIndex.ForEachActorInBox(FBox(Spatial.Near->Center - Radius, Spatial.Near->Center + Radius), Visit);
             }
-            return MakeListResult(Results);
+            else if (Spatial.Box)
+            {
+                ActorIndex.ForEachActorInBox(*Spatial.Box, Visit);
+            }
+            else
+            {
+                ActorIndex.ForEachActorInFrustum(*Spatial.Frustum, Visit);
+            }
+
+            Hits.Sort([](const TPair<double, AActor*>& A, const TPair<double, AActor*>& B) { return A.Key < B.Key; });
+
+            const bool bTruncated = Hits.Num() > FMCPResultPages::MaxItems;
+            TArray<TPair<double, TWeakObjectPtr<AActor>>> Matches;
+            Matches.Reserve(FMath::Min(Hits.Num(), FMCPResultPages::MaxItems));
+            for (int32 i = 0; i < Hits.Num() && i < FMCPResultPages::MaxItems; ++i)
+            {
+                Matches.Emplace(Hits[i].Key, Hits[i].Value);
+            }
+            return MakeListResult(Context, MoveTemp(Matches), bTruncated, Limit, true,
+                [](const TPair<double, TWeakObjectPtr<AActor>>& Match) -> TSharedPtr<FJsonValue>
+                {
+                    AActor* Actor = Match.Value.Get();
+                    if (!Actor) return nullptr;
+                    TSharedPtr<FJsonObject> ActorObj = MakeActorJson(Actor);
+                    ActorObj->SetField(TEXT("distance"), FMCPJsonHelpers::RoundedJsonNumber(Match.Key));
+                    return MakeShared<FJsonValueObject>(ActorObj);
+                });
         }
 
         // ── type=class ──────────────────────────────────────────────────────
@@ -246,27 +539,31 @@ FMCPToolResult FMCPTool_Find::Execute(const TSharedPtr<FJsonObject>& Params)
             UClass* ParentClass = UObject::StaticClass();
             if (!ParentStr.IsEmpty())
             {
-                UClass* Found = FindFirstObject<UClass>(*ParentStr, EFindFirstObjectOptions::EnsureIfAmbiguous);
+                UClass* Found = FMCPClassIndex::Get().FindClass(ParentStr);
                 if (Found) ParentClass = Found;
             }
 
             TArray<UClass*> DerivedClasses;
-            GetDerivedClasses(ParentClass, DerivedClasses, true);
+            FMCPClassIndex::Get().GetDerivedClasses(ParentClass, DerivedClasses);
 
-            TArray<TSharedPtr<FJsonValue>> Results;
+            TArray<TWeakObjectPtr<UClass>> Matches;
+            bool bTruncated = false;
             for (UClass* Class : DerivedClasses)
             {
                 if (!Class) continue;
                 if (!PassesFilters(Class->GetName())) continue;
-
-                TSharedPtr<FJsonObject> ClassObj = MakeShared<FJsonObject>();
-                ClassObj->SetStringField(TEXT("name"), Class->GetName());
-                ClassObj->SetStringField(TEXT("path"), Class->GetPathName());
-                Results.Add(MakeShared<FJsonValueObject>(ClassObj));
-
-                if (Results.Num() >= Limit) break;
+                if (!AddHandle(Matches, TWeakObjectPtr<UClass>(Class), bTruncated)) break;
             }
-            return MakeListResult(Results);
+            return MakeListResult(Context, MoveTemp(Matches), bTruncated, Limit, true,
+                [](const TWeakObjectPtr<UClass>& WeakClass) -> TSharedPtr<FJsonValue>
+                {
+                    UClass* Class = WeakClass.Get();
+                    if (!Class) return nullptr;
+                    TSharedPtr<FJsonObject> ClassObj = MakeShared<FJsonObject>();
+                    ClassObj->SetStringField(TEXT("name"), Class->GetName());
+                    ClassObj->SetStringField(TEXT("path"), Class->GetPathName());
+                    return MakeShared<FJsonValueObject>(ClassObj);
+                });
         }
 
         // ── type=property ───────────────────────────────────────────────────
@@ -281,21 +578,27 @@ FMCPToolResult FMCPTool_Find::Execute(const TSharedPtr<FJsonObject>& Params)
             UObject* Obj = FMCPObjectResolver::ResolveObject(TargetStr, Error);
             if (!Obj) return FMCPToolResult::Error(Error);
 
-            TArray<TSharedPtr<FJsonValue>> Results;
+            // Properties are looked up by name again when written, since a recompile can replace them.
+            TArray<FName> Matches;
+            bool bTruncated = false;
             for (TFieldIterator<FProperty> It(Obj->GetClass()); It; ++It)
             {
                 FProperty* Prop = *It;
                 if (!PassesFilters(Prop->GetName())) continue;
-
-                TSharedPtr<FJsonObject> PropObj = MakeShared<FJsonObject>();
-                PropObj->SetStringField(TEXT("name"),     Prop->GetName());
-                PropObj->SetStringField(TEXT("type"),     Prop->GetCPPType());
-                PropObj->SetStringField(TEXT("category"), Prop->GetMetaData(TEXT("Category")));
-                Results.Add(MakeShared<FJsonValueObject>(PropObj));
-
-                if (Results.Num() >= Limit) break;
+                if (!AddHandle(Matches, Prop->GetFName(), bTruncated)) break;
             }
-            return MakeListResult(Results);
+            return MakeListResult(Context, MoveTemp(Matches), bTruncated, Limit, true,
+                [WeakClass = TWeakObjectPtr<UClass>(Obj->GetClass())](FName PropName) -> TSharedPtr<FJsonValue>
+                {
+                    UClass* Class = WeakClass.Get();
+                    FProperty* Prop = Class ? FindFProperty<FProperty>(Class, PropName) : nullptr;
+                    if (!Prop) return nullptr;
+                    TSharedPtr<FJsonObject> PropObj = MakeShared<FJsonObject>();
+                    PropObj->SetStringField(TEXT("name"),     Prop->GetName());
+                    PropObj->SetStringField(TEXT("type"),     Prop->GetCPPType());
+                    PropObj->SetStringField(TEXT("category"), Prop->GetMetaData(TEXT("Category")));
+                    return MakeShared<FJsonValueObject>(PropObj);
+                });
         }
 
         // ── type=selection ──────────────────────────────────────────────────
@@ -311,13 +614,14 @@ FMCPToolResult FMCPTool_Find::Execute(const TSharedPtr<FJsonObject>& Params)
                 return FMCPToolResult::Error(TEXT("EditorActorSubsystem not available"));
             }
 
-            TArray<TSharedPtr<FJsonValue>> Results;
+            TArray<TWeakObjectPtr<AActor>> Matches;
+            bool bTruncated = false;
             for (AActor* Actor : ActorSub->GetSelectedLevelActors())
             {
                 if (!Actor) continue;
-                Results.Add(MakeShared<FJsonValueObject>(MakeActorJson(Actor)));
+                if (!AddHandle(Matches, TWeakObjectPtr<AActor>(Actor), bTruncated)) break;
             }
-            return MakeListResult(Results);
+            return MakeListResult(Context, MoveTemp(Matches), bTruncated, Limit, true, &MakeActorJsonValue);
         }
 
         return FMCPToolResult::Error(FString::Printf(TEXT("Unknown type: '%s'. Valid: asset, actor, class, property, selection"), *Type));
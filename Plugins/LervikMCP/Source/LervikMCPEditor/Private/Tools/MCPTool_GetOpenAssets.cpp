@@ -1,13 +1,12 @@
 #include "Tools/MCPTool_GetOpenAssets.h"
 #include "MCPToolHelp.h"
+#include "MCPGameThreadHelper.h"
 #include "Editor.h"
 #include "Subsystems/AssetEditorSubsystem.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
 #include "Serialization/JsonWriter.h"
 #include "Serialization/JsonSerializer.h"
-#include "Async/Async.h"
-#include "Async/TaskGraphInterfaces.h"
 
 namespace
 {
@@ -32,10 +31,15 @@ FMCPToolInfo FMCPTool_GetOpenAssets::GetToolInfo() const
 }
 
 FMCPToolResult FMCPTool_GetOpenAssets::Execute(const TSharedPtr<FJsonObject>& Params)
+{
+    return ExecuteAsync(Params, FMCPToolContext()).Get();
+}
+
+TFuture<FMCPToolResult> FMCPTool_GetOpenAssets::ExecuteAsync(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context)
 {
     FMCPToolResult HelpResult;
     if (MCPToolHelp::CheckAndHandleHelp(Params, sGetOpenAssetsHelp, HelpResult))
-        return HelpResult;
+        return MakeFulfilledPromise<FMCPToolResult>(MoveTemp(HelpResult)).GetFuture();
 
     auto DoWork = []() -> FMCPToolResult
     {
@@ -76,21 +80,5 @@ FMCPToolResult FMCPTool_GetOpenAssets::Execute(const TSharedPtr<FJsonObject>& Pa
         return FMCPToolResult::Text(OutputString);
     };
 
-    if (IsInGameThread())
-    {
-        return DoWork();
-    }
-
-    FMCPToolResult Result;
-    FEvent* DoneEvent = FPlatformProcess::GetSynchEventFromPool(true);
-
-    AsyncTask(ENamedThreads::GameThread, [&Result, &DoWork, DoneEvent]()
-    {
-        Result = DoWork();
-        DoneEvent->Trigger();
-    });
-
-    DoneEvent->Wait();
-    FPlatformProcess::ReturnSynchEventToPool(DoneEvent);
-    return Result;
+    return ExecuteOnGameThreadAsync(Context, MoveTemp(DoWork));
 }
@@ -3,6 +3,7 @@
 #include "MCPJsonHelpers.h"
 #include "MCPToolHelp.h"
 #include "MCPObjectResolver.h"
+#include "MCPClassIndex.h"
 #include "MCPGraphHelpers.h"
 
 // Blueprint graph includes
@@ -345,7 +346,7 @@ namespace
         if (TypeStr.StartsWith(TEXT("Object:"), ESearchCase::IgnoreCase))
         {
             FString ClassName = TypeStr.Mid(7);
-            UClass* FoundClass = FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::EnsureIfAmbiguous);
+            UClass* FoundClass = FMCPClassIndex::Get().FindClass(ClassName);
             if (!FoundClass) return false;
             OutType.PinCategory = UEdGraphSchema_K2::PC_Object;
             OutType.PinSubCategoryObject = FoundClass;
@@ -447,7 +448,7 @@ namespace
                 UClass* OwnerClass = nullptr;
                 if (!FuncOwner.IsEmpty())
                 {
-                    OwnerClass = FindFirstObject<UClass>(*FuncOwner, EFindFirstObjectOptions::EnsureIfAmbiguous);
+                    OwnerClass = FMCPClassIndex::Get().FindClass(FuncOwner);
                 }
                 if (OwnerClass)
                 {
@@ -598,7 +599,7 @@ namespace
             NodeParams->TryGetStringField(TEXT("function_owner"), TargetClassName);
             if (!TargetClassName.IsEmpty())
             {
-                UClass* TargetClass = FindFirstObject<UClass>(*TargetClassName, EFindFirstObjectOptions::EnsureIfAmbiguous);
+                UClass* TargetClass = FMCPClassIndex::Get().FindClass(TargetClassName);
                 if (TargetClass)
                 {
                     CastNode->TargetType = TargetClass;
@@ -837,10 +838,10 @@ namespace
                     FullClassName = FString::Printf(TEXT("MaterialExpression%s"), *ExprClassName);
                 }
 
-                UClass* ExprClass = FindFirstObject<UClass>(*FullClassName, EFindFirstObjectOptions::EnsureIfAmbiguous);
+                UClass* ExprClass = FMCPClassIndex::Get().FindClass(FullClassName);
                 if (!ExprClass)
                 {
-                    ExprClass = FindFirstObject<UClass>(*ExprClassName, EFindFirstObjectOptions::EnsureIfAmbiguous);
+                    ExprClass = FMCPClassIndex::Get().FindClass(ExprClassName);
                 }
                 if (!ExprClass || !ExprClass->IsChildOf(UMaterialExpression::StaticClass()))
                 {
@@ -1844,7 +1845,7 @@ namespace
 
             if (ClassName.IsEmpty()) continue;
 
-            UClass* CompClass = FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::EnsureIfAmbiguous);
+            UClass* CompClass = FMCPClassIndex::Get().FindClass(ClassName);
             if (!CompClass || !CompClass->IsChildOf(UActorComponent::StaticClass())) continue;
 
             USCS_Node* NewNode = SCS->CreateNode(CompClass, CompName.IsEmpty() ? NAME_None : FName(*CompName));
@@ -2013,12 +2014,17 @@ FMCPToolInfo FMCPTool_Graph::GetToolInfo() const
 }
 
 FMCPToolResult FMCPTool_Graph::Execute(const TSharedPtr<FJsonObject>& Params)
+{
+    return ExecuteAsync(Params, FMCPToolContext()).Get();
+}
+
+TFuture<FMCPToolResult> FMCPTool_Graph::ExecuteAsync(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context)
 {
     FMCPToolResult HelpResult;
     if (MCPToolHelp::CheckAndHandleHelp(Params, sGraphHelp, HelpResult))
-        return HelpResult;
+        return MakeFulfilledPromise<FMCPToolResult>(MoveTemp(HelpResult)).GetFuture();
 
-    return ExecuteOnGameThread([Params]() -> FMCPToolResult
+    return ExecuteOnGameThreadAsync(Context, [Params]() -> FMCPToolResult
     {
         FString Action, Target;
         if (!Params->TryGetStringField(TEXT("action"), Action))
@@ -3,6 +3,7 @@
 #include "MCPGraphHelpers.h"
 #include "MCPJsonHelpers.h"
 #include "MCPSearchPatterns.h"
+#include "MCPResultPages.h"
 #include "MCPToolHelp.h"
 #include "MCPObjectResolver.h"
 
@@ -199,16 +200,27 @@ namespace
         { TEXT("target"), TEXT("string"),  true,  TEXT("Format: 'AssetPath::NodeGUID'"), nullptr, TEXT("/Game/BP_MyActor::A1B2C3D4") },
     };
 
+    static const FMCPParamHelp sInspectPagedParams[] = {
+        { TEXT("limit"),  TEXT("integer"), false, TEXT("Page size. Default: 100"), nullptr, nullptr },
+        { TEXT("cursor"), TEXT("string"),  false, TEXT("next_cursor from a previous page; other params are ignored"), nullptr, nullptr },
+    };
+
+    static const FMCPParamHelp sInspectConnectionsParams[] = {
+        { TEXT("target"), TEXT("string"),  true,  TEXT("Format: 'AssetPath::NodeGUID'"), nullptr, TEXT("/Game/BP_MyActor::A1B2C3D4") },
+        { TEXT("limit"),  TEXT("integer"), false, TEXT("Page size. Default: 100"), nullptr, nullptr },
+        { TEXT("cursor"), TEXT("string"),  false, TEXT("next_cursor from a previous page; other params are ignored"), nullptr, nullptr },
+    };
+
     static const FMCPActionHelp sInspectActions[] = {
         { TEXT("properties"),  TEXT("Inspect UObject properties via reflection"), sInspectPropsParams, UE_ARRAY_COUNT(sInspectPropsParams), nullptr },
         { TEXT("components"),  TEXT("List components on an actor or Blueprint"), nullptr, 0, nullptr },
-        { TEXT("nodes"),       TEXT("List Blueprint graph nodes or Material expression nodes"), nullptr, 0, nullptr },
-        { TEXT("expressions"), TEXT("List Material expressions (alias for nodes on Materials)"), nullptr, 0, nullptr },
+        { TEXT("nodes"),       TEXT("List Blueprint graph nodes or Material expression nodes"), sInspectPagedParams, UE_ARRAY_COUNT(sInspectPagedParams), nullptr },
+        { TEXT("expressions"), TEXT("List Material expressions (alias for nodes on Materials)"), sInspectPagedParams, UE_ARRAY_COUNT(sInspectPagedParams), nullptr },
         { TEXT("variables"),   TEXT("List Blueprint variables"), nullptr, 0, nullptr },
         { TEXT("functions"),   TEXT("List Blueprint function graphs"), nullptr, 0, nullptr },
         { TEXT("pins"),        TEXT("List pins on a specific node. Target: 'AssetPath::NodeGUID'"), sInspectPinsParams, UE_ARRAY_COUNT(sInspectPinsParams), nullptr },
         { TEXT("parameters"),  TEXT("List Material parameters"), nullptr, 0, nullptr },
-        { TEXT("connections"), TEXT("List connections on a specific node. Target: 'AssetPath::NodeGUID'"), sInspectPinsParams, UE_ARRAY_COUNT(sInspectPinsParams), nullptr },
+        { TEXT("connections"), TEXT("List connections on a specific node. Target: 'AssetPath::NodeGUID'"), sInspectConnectionsParams, UE_ARRAY_COUNT(sInspectConnectionsParams), nullptr },
         { TEXT("hlsl"), TEXT("Generate pseudo-HLSL representation of a Material's expression graph with node IDs and positions"), nullptr, 0, nullptr },
         { TEXT("cpp"), TEXT("Generate pseudo-C++ representation of a Blueprint graph with node IDs and positions. Target: 'BlueprintPath::GraphName' (default: EventGraph)"), nullptr, 0, nullptr },
     };
@@ -221,6 +233,76 @@ namespace
         sInspectCommonParams, UE_ARRAY_COUNT(sInspectCommonParams)
     };
 
+    /** A Blueprint graph node or material expression for inspect type=nodes, written when its page is returned. */
+    struct FNodeHandle
+    {
+        TWeakObjectPtr<UObject> Node;
+        FString Graph;
+    };
+
+    TSharedPtr<FJsonValue> MakeNodeHandleJson(const FNodeHandle& Handle)
+    {
+        if (UEdGraphNode* Node = Cast<UEdGraphNode>(Handle.Node.Get()))
+        {
+            TSharedPtr<FJsonObject> NodeObj = MakeNodeJson(Node);
+            NodeObj->SetStringField(TEXT("graph"), Handle.Graph);
+            return MakeShared<FJsonValueObject>(NodeObj);
+        }
+        if (UMaterialExpression* Expr = Cast<UMaterialExpression>(Handle.Node.Get()))
+        {
+            return MakeShared<FJsonValueObject>(MakeExpressionJson(Expr));
+        }
+        return nullptr;
+    }
+
+    /**
+     * One edge for inspect type=connections. Blueprint edges run pin to pin within Graph; material edges run
+     * from an expression output to another expression's input, or to ToProperty on the material.
+     */
+    struct FConnectionHandle
+    {
+        FGuid FromNode;
+        FString FromPin;
+        int32 FromOutputIndex = INDEX_NONE;
+        FGuid ToNode;
+        FString ToPin;
+        FString ToProperty;
+        FString Graph;
+    };
+
+    TSharedPtr<FJsonValue> MakeConnectionJson(const FConnectionHandle& Conn)
+    {
+        TSharedPtr<FJsonObject> ConnObj = MakeShared<FJsonObject>();
+        ConnObj->SetStringField(TEXT("from_node"), FMCPJsonHelpers::GuidToCompact(Conn.FromNode));
+        if (Conn.FromOutputIndex != INDEX_NONE)
+            ConnObj->SetNumberField(TEXT("from_output_index"), Conn.FromOutputIndex);
+        else
+            ConnObj->SetStringField(TEXT("from_pin"), Conn.FromPin);
+        if (!Conn.ToProperty.IsEmpty())
+        {
+            ConnObj->SetStringField(TEXT("to_property"), Conn.ToProperty);
+        }
+        else
+        {
+            ConnObj->SetStringField(TEXT("to_node"), FMCPJsonHelpers::GuidToCompact(Conn.ToNode));
+            ConnObj->SetStringField(TEXT("to_pin"),  Conn.ToPin);
+        }
+        if (!Conn.Graph.IsEmpty())
+            ConnObj->SetStringField(TEXT("graph"), Conn.Graph);
+        return MakeShared<FJsonValueObject>(ConnObj);
+    }
+
+    /** True while fewer than FMCPResultPages::MaxItems handles are collected; otherwise sets bTruncated. */
+    template<typename THandle>
+    bool HasRoomForMatch(const TArray<THandle>& Matches, bool& bTruncated)
+    {
+        if (Matches.Num() >= FMCPResultPages::MaxItems)
+        {
+            bTruncated = true;
+            return false;
+        }
+        return true;
+    }
 }
 
 FMCPToolInfo FMCPTool_Inspect::GetToolInfo() const
@@ -234,18 +316,29 @@ FMCPToolInfo FMCPTool_Inspect::GetToolInfo() const
         { TEXT("filter"), TEXT("Glob/regex to filter results by name"), TEXT("string"), false },
         { TEXT("depth"),  TEXT("Property traversal depth. Default: 1"),          TEXT("integer"), false },
         { TEXT("detail"), TEXT("Values: all|skip_defaults. Default: skip_defaults. skip_defaults omits properties with default/empty values"), TEXT("string"), false },
+        { TEXT("limit"),  TEXT("[nodes|expressions|connections] Page size. Default: 100. Results past it are returned with a next_cursor"), TEXT("integer"), false },
+        { TEXT("cursor"), TEXT("next_cursor from a previous page. Serves the next page without re-walking the graph"), TEXT("string"), false },
         { TEXT("help"),   TEXT("Pass help=true for overview, help='type_name' for detailed parameter info"), TEXT("string"), false },
     };
     return Info;
 }
 
 FMCPToolResult FMCPTool_Inspect::Execute(const TSharedPtr<FJsonObject>& Params)
+{
+    return ExecuteAsync(Params, FMCPToolContext()).Get();
+}
+
+TFuture<FMCPToolResult> FMCPTool_Inspect::ExecuteAsync(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context)
 {
     FMCPToolResult HelpResult;
     if (MCPToolHelp::CheckAndHandleHelp(Params, sInspectHelp, HelpResult))
-        return HelpResult;
+        return MakeFulfilledPromise<FMCPToolResult>(MoveTemp(HelpResult)).GetFuture();
 
-    return ExecuteOnGameThread([Params]() -> FMCPToolResult
+    TFuture<FMCPToolResult> PageResult;
+    if (FMCPResultPages::Get().TryServeCursor(Params, Context, TEXT("inspect"), PageResult))
+        return PageResult;
+
+    return ExecuteOnGameThreadAsync(Context, [Params, Context]() -> FMCPToolResult
     {
         FString TargetParam;
         if (!Params->TryGetStringField(TEXT("target"), TargetParam))
@@ -265,9 +358,14 @@ FMCPToolResult FMCPTool_Inspect::Execute(const TSharedPtr<FJsonObject>& Params)
         Params->TryGetStringField(TEXT("detail"), DetailParam);
         bool bSkipDefaults = !DetailParam.Equals(TEXT("all"), ESearchCase::IgnoreCase);
 
+        double LimitD = 100.0;
+        Params->TryGetNumberField(TEXT("limit"), LimitD);
+        const int32 Limit = FMath::Max(1, FMath::FloorToInt(LimitD));
+
+        const FMCPCompiledPattern FilterPattern = FMCPSearchPatterns::Compile(Filter);
         auto PassesFilter = [&](const FString& Name) -> bool
         {
-            return Filter.IsEmpty() || FMCPSearchPatterns::Matches(Filter, Name);
+            return FilterPattern.Matches(Name);
         };
 
         // ── pins / connections: target = "AssetPath::NodeGUID" ─────────────
@@ -382,7 +480,8 @@ FMCPToolResult FMCPTool_Inspect::Execute(const TSharedPtr<FJsonObject>& Params)
         {
             if (!Obj) return FMCPToolResult::Error(ResolveError);
 
-            TArray<TSharedPtr<FJsonValue>> ResultArray;
+            TArray<FNodeHandle> Matches;
+            bool bTruncated = false;
 
             // Blueprint path
             if (UBlueprint* Blueprint = Cast<UBlueprint>(Obj))
@@ -392,15 +491,15 @@ FMCPToolResult FMCPTool_Inspect::Execute(const TSharedPtr<FJsonObject>& Params)
 
                 for (UEdGraph* Graph : AllGraphs)
                 {
+                    if (bTruncated) break;
                     for (UEdGraphNode* Node : Graph->Nodes)
                     {
                         if (!Node) continue;
                         FString NodeName = Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString();
                         if (!PassesFilter(NodeName) && !PassesFilter(Node->GetClass()->GetName())) continue;
 
-                        TSharedPtr<FJsonObject> NodeObj = MakeNodeJson(Node);
-                        NodeObj->SetStringField(TEXT("graph"), Graph->GetName());
-                        ResultArray.Add(MakeShared<FJsonValueObject>(NodeObj));
+                        if (!HasRoomForMatch(Matches, bTruncated)) break;
+                        Matches.Add({ Node, Graph->GetName() });
                     }
                 }
             }
@@ -414,7 +513,8 @@ FMCPToolResult FMCPTool_Inspect::Execute(const TSharedPtr<FJsonObject>& Params)
                     if (!Expr) continue;
                     if (!PassesFilter(Expr->GetClass()->GetName()) && !PassesFilter(Expr->GetDescription())) continue;
 
-                    ResultArray.Add(MakeShared<FJsonValueObject>(MakeExpressionJson(Expr)));
+                    if (!HasRoomForMatch(Matches, bTruncated)) break;
+                    Matches.Add({ Expr, FString() });
                 }
             }
             else
@@ -423,10 +523,9 @@ FMCPToolResult FMCPTool_Inspect::Execute(const TSharedPtr<FJsonObject>& Params)
             }
 
             FString ResponseKey = TypeParam.Equals(TEXT("expressions"), ESearchCase::IgnoreCase) ? TEXT("expressions") : TEXT("nodes");
-            TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-            Result->SetArrayField(ResponseKey, ResultArray);
-            Result->SetNumberField(TEXT("count"), ResultArray.Num());
-            return FMCPJsonHelpers::SuccessResponse(Result);
+            FMCPResultList List = FMCPResultList::FromHandles(ResponseKey, MoveTemp(Matches), &MakeNodeHandleJson);
+            List.bTruncated = bTruncated;
+            return FMCPResultPages::Get().MakeFirstPage(Context, TEXT("inspect"), MoveTemp(List), Limit);
         }
 
         // ── variables ───────────────────────────────────────────────────────
@@ -656,7 +755,8 @@ FMCPToolResult FMCPTool_Inspect::Execute(const TSharedPtr<FJsonObject>& Params)
         {
             if (!Obj) return FMCPToolResult::Error(ResolveError);
 
-            TArray<TSharedPtr<FJsonValue>> ResultArray;
+            TArray<FConnectionHandle> Matches;
+            bool bTruncated = false;
 
             if (UBlueprint* Blueprint = Cast<UBlueprint>(Obj))
             {
@@ -665,11 +765,14 @@ FMCPToolResult FMCPTool_Inspect::Execute(const TSharedPtr<FJsonObject>& Params)
 
                 for (UEdGraph* Graph : AllGraphs)
                 {
+                    if (bTruncated) break;
                     for (UEdGraphNode* Node : Graph->Nodes)
                     {
+                        if (bTruncated) break;
                         if (!Node) continue;
                         for (UEdGraphPin* Pin : Node->Pins)
                         {
+                            if (bTruncated) break;
                             if (!Pin || Pin->Direction != EGPD_Output || Pin->LinkedTo.Num() == 0) continue;
 
                             for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
@@ -677,13 +780,13 @@ FMCPToolResult FMCPTool_Inspect::Execute(const TSharedPtr<FJsonObject>& Params)
                                 if (!LinkedPin || !LinkedPin->GetOwningNodeUnchecked()) continue;
                                 if (!PassesFilter(Pin->PinName.ToString()) && !PassesFilter(LinkedPin->PinName.ToString()) && !PassesFilter(Graph->GetName())) continue;
 
-                                TSharedPtr<FJsonObject> ConnObj = MakeShared<FJsonObject>();
-                                ConnObj->SetStringField(TEXT("from_node"),  FMCPJsonHelpers::GuidToCompact(Node->NodeGuid));
-                                ConnObj->SetStringField(TEXT("from_pin"),   Pin->PinName.ToString());
-                                ConnObj->SetStringField(TEXT("to_node"),    FMCPJsonHelpers::GuidToCompact(LinkedPin->GetOwningNode()->NodeGuid));
-                                ConnObj->SetStringField(TEXT("to_pin"),     LinkedPin->PinName.ToString());
-                                ConnObj->SetStringField(TEXT("graph"),      Graph->GetName());
-                                ResultArray.Add(MakeShared<FJsonValueObject>(ConnObj));
+                                if (!HasRoomForMatch(Matches, bTruncated)) break;
+                                FConnectionHandle& Conn = Matches.AddDefaulted_GetRef();
+                                Conn.FromNode = Node->NodeGuid;
+                                Conn.FromPin  = Pin->PinName.ToString();
+                                Conn.ToNode   = LinkedPin->GetOwningNode()->NodeGuid;
+                                Conn.ToPin    = LinkedPin->PinName.ToString();
+                                Conn.Graph    = Graph->GetName();
                             }
                         }
                     }
@@ -696,8 +799,8 @@ FMCPToolResult FMCPTool_Inspect::Execute(const TSharedPtr<FJsonObject>& Params)
                 // Expression-to-expression edges
                 for (UMaterialExpression* Expr : Material->GetExpressions())
                 {
+                    if (bTruncated) break;
                     if (!Expr) continue;
-                    FString ToGuid = FMCPJsonHelpers::GuidToCompact(Expr->MaterialExpressionGuid);
                     const int32 InputCount = FMCPGraphHelpers::GetExpressionInputCount(Expr);
                     for (int32 i = 0; i < InputCount; ++i)
                     {
@@ -705,12 +808,12 @@ FMCPToolResult FMCPTool_Inspect::Execute(const TSharedPtr<FJsonObject>& Params)
                         if (!Input || !Input->Expression) continue;
                         if (!PassesFilter(Expr->GetInputName(i).ToString())) continue;
 
-                        TSharedPtr<FJsonObject> ConnObj = MakeShared<FJsonObject>();
-                        ConnObj->SetStringField(TEXT("from_node"),         FMCPJsonHelpers::GuidToCompact(Input->Expression->MaterialExpressionGuid));
-                        ConnObj->SetNumberField(TEXT("from_output_index"), Input->OutputIndex);
-                        ConnObj->SetStringField(TEXT("to_node"),           ToGuid);
-                        ConnObj->SetStringField(TEXT("to_pin"),            Expr->GetInputName(i).ToString());
-                        ResultArray.Add(MakeShared<FJsonValueObject>(ConnObj));
+                        if (!HasRoomForMatch(Matches, bTruncated)) break;
+                        FConnectionHandle& Conn = Matches.AddDefaulted_GetRef();
+                        Conn.FromNode        = Input->Expression->MaterialExpressionGuid;
+                        Conn.FromOutputIndex = Input->OutputIndex;
+                        Conn.ToNode          = Expr->MaterialExpressionGuid;
+                        Conn.ToPin           = Expr->GetInputName(i).ToString();
                     }
                 }
 
@@ -721,11 +824,11 @@ FMCPToolResult FMCPTool_Inspect::Execute(const TSharedPtr<FJsonObject>& Params)
                     if (!PropInput || !PropInput->Expression) continue;
                     if (!PassesFilter(KP.Name)) continue;
 
-                    TSharedPtr<FJsonObject> ConnObj = MakeShared<FJsonObject>();
-                    ConnObj->SetStringField(TEXT("from_node"),         FMCPJsonHelpers::GuidToCompact(PropInput->Expression->MaterialExpressionGuid));
-                    ConnObj->SetNumberField(TEXT("from_output_index"), PropInput->OutputIndex);
-                    ConnObj->SetStringField(TEXT("to_property"),       KP.Name);
-                    ResultArray.Add(MakeShared<FJsonValueObject>(ConnObj));
+                    if (!HasRoomForMatch(Matches, bTruncated)) break;
+                    FConnectionHandle& Conn = Matches.AddDefaulted_GetRef();
+                    Conn.FromNode        = PropInput->Expression->MaterialExpressionGuid;
+                    Conn.FromOutputIndex = PropInput->OutputIndex;
+                    Conn.ToProperty      = KP.Name;
                 }
             }
             else
@@ -733,10 +836,9 @@ FMCPToolResult FMCPTool_Inspect::Execute(const TSharedPtr<FJsonObject>& Params)
                 return FMCPToolResult::Error(FString::Printf(TEXT("'%s' is not a Blueprint or Material"), *AssetPath));
             }
 
-            TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-            Result->SetArrayField(TEXT("connections"), ResultArray);
-            Result->SetNumberField(TEXT("count"), ResultArray.Num());
-            return FMCPJsonHelpers::SuccessResponse(Result);
+            FMCPResultList List = FMCPResultList::FromHandles(TEXT("connections"), MoveTemp(Matches), &MakeConnectionJson);
+            List.bTruncated = bTruncated;
+            return FMCPResultPages::Get().MakeFirstPage(Context, TEXT("inspect"), MoveTemp(List), Limit);
         }
 
         // ── hlsl ─────────────────────────────────────────────────────────────
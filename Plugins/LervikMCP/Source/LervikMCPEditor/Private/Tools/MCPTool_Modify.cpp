@@ -3,6 +3,7 @@
 #include "MCPJsonHelpers.h"
 #include "MCPToolHelp.h"
 #include "MCPObjectResolver.h"
+#include "MCPActorIndex.h"
 #include "MCPPropertyHelpers.h"
 
 #include "ScopedTransaction.h"
@@ -49,12 +50,17 @@ FMCPToolInfo FMCPTool_Modify::GetToolInfo() const
 }
 
 FMCPToolResult FMCPTool_Modify::Execute(const TSharedPtr<FJsonObject>& Params)
+{
+    return ExecuteAsync(Params, FMCPToolContext()).Get();
+}
+
+TFuture<FMCPToolResult> FMCPTool_Modify::ExecuteAsync(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context)
 {
     FMCPToolResult HelpResult;
     if (MCPToolHelp::CheckAndHandleHelp(Params, sModifyHelp, HelpResult))
-        return HelpResult;
+        return MakeFulfilledPromise<FMCPToolResult>(MoveTemp(HelpResult)).GetFuture();
 
-    return ExecuteOnGameThread([Params]() -> FMCPToolResult
+    return ExecuteOnGameThreadAsync(Context, [Params]() -> FMCPToolResult
     {
         FString TargetParam;
         if (!Params->TryGetStringField(TEXT("target"), TargetParam))
@@ -160,6 +166,9 @@ FMCPToolResult FMCPTool_Modify::Execute(const TSharedPtr<FJsonObject>& Params)
         }
 
         Object->PostEditChange();
+        // Transform and property edits can both move an actor's bounds.
+        if (AActor* Actor = Cast<AActor>(Object))
+            FMCPActorIndex::Get().NotifyActorMoved(Actor);
         if (UMaterial* Mat = Cast<UMaterial>(OriginalObject))
             FMCPGraphHelpers::RefreshMaterialEditor(Mat);
         if (OriginalOwningMat)
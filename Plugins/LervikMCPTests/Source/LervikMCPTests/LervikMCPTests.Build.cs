@@ -19,10 +19,15 @@ public class LervikMCPTests : ModuleRules
             "AssetTools",
             "AssetRegistry",
             "MaterialEditor",
+            "TraceServices", "TraceAnalysis",
         });
 
         // Access LervikMCPEditor private headers for test sync guards
         PrivateIncludePaths.Add(System.IO.Path.GetFullPath(
             System.IO.Path.Combine(ModuleDirectory, "../../../LervikMCP/Source/LervikMCPEditor/Private")));
+
+        // The trace benchmark replays events through LervikMCP's private tree builder
+        PrivateIncludePaths.Add(System.IO.Path.GetFullPath(
+            System.IO.Path.Combine(ModuleDirectory, "../../../LervikMCP/Source/LervikMCP/Private")));
     }
 }
@@ -0,0 +1,173 @@
+#include "Misc/AutomationTest.h"
+#include "MCPCompactGuidTable.h"
+#include "Async/ParallelFor.h"
+#include "Misc/Base64.h"
+#include "Misc/ScopeLock.h"
+
+/**
+ * Compares the compact GUID table against the single-lock map + FBase64 encoding it replaced,
+ * single-threaded and from a ParallelFor. Timings are reported with AddInfo.
+ */
+BEGIN_DEFINE_SPEC(FMCPCompactGuidBenchmark, "Plugins.LervikMCP.Benchmark.CompactGuid",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+    /** The previous FMCPSessionManager implementation, kept here as the baseline. */
+    struct FLockedGuidMap
+    {
+        FCriticalSection Lock;
+        TMap<FGuid, int32> GuidToIndex;
+        TArray<FGuid> IndexToGuid;
+
+        FString ToCompact(const FGuid& Guid)
+        {
+            FScopeLock ScopeLock(&Lock);
+            int32 Index;
+            if (const int32* Found = GuidToIndex.Find(Guid))
+            {
+                Index = *Found;
+            }
+            else
+            {
+                Index = IndexToGuid.Add(Guid);
+                GuidToIndex.Add(Guid, Index);
+            }
+
+            TArray<uint8> Bytes;
+            if (Index == 0)
+            {
+                Bytes.Add(0);
+            }
+            while (Index > 0)
+            {
+                Bytes.Insert(static_cast<uint8>(Index & 0xFF), 0);
+                Index >>= 8;
+            }
+            FString B64 = FBase64::Encode(Bytes.GetData(), Bytes.Num());
+            while (B64.Len() > 0 && B64[B64.Len() - 1] == TEXT('='))
+            {
+                B64.LeftChopInline(1);
+            }
+            return B64;
+        }
+
+        FGuid FromCompact(const FString& Compact)
+        {
+            FString Padded = Compact;
+            while (Padded.Len() % 4 != 0)
+            {
+                Padded.AppendChar(TEXT('='));
+            }
+            TArray<uint8> Bytes;
+            if (!FBase64::Decode(Padded, Bytes) || Bytes.Num() == 0)
+            {
+                return FGuid();
+            }
+            int32 Index = 0;
+            for (const uint8 Byte : Bytes)
+            {
+                Index = (Index << 8) | Byte;
+            }
+            FScopeLock ScopeLock(&Lock);
+            return IndexToGuid.IsValidIndex(Index) ? IndexToGuid[Index] : FGuid();
+        }
+    };
+
+    TArray<FGuid> Guids;
+
+    /** Nanoseconds per GUID for a full ToCompact + FromCompact round trip, run Passes times over Guids. */
+    template<typename TTable>
+    double TimeRoundTrips(TTable& Table, bool bParallel, int32 Passes, int32& OutMismatches)
+    {
+        TAtomic<int32> Mismatches { 0 };
+        const int32 Count = Guids.Num() * Passes;
+        const auto RoundTrip = [&](int32 i)
+        {
+            const FGuid& Guid = Guids[i % Guids.Num()];
+            if (Table.FromCompact(Table.ToCompact(Guid)) != Guid)
+            {
+                ++Mismatches;
+            }
+        };
+
+        const double Start = FPlatformTime::Seconds();
+        if (bParallel)
+        {
+            ParallelFor(Count, RoundTrip);
+        }
+        else
+        {
+            for (int32 i = 0; i < Count; ++i)
+            {
+                RoundTrip(i);
+            }
+        }
+        OutMismatches = Mismatches.Load();
+        return (FPlatformTime::Seconds() - Start) * 1e9 / FMath::Max(1, Count);
+    }
+
+    void Compare(bool bParallel)
+    {
+        const TCHAR* Mode = bParallel ? TEXT("ParallelFor") : TEXT("single thread");
+        constexpr int32 Passes = 4;
+
+        FLockedGuidMap Locked;
+        int32 LockedMismatches = 0;
+        const double LockedNs = TimeRoundTrips(Locked, bParallel, Passes, LockedMismatches);
+
+        FMCPCompactGuidTable Table;
+        int32 TableMismatches = 0;
+        const double TableNs = TimeRoundTrips(Table, bParallel, Passes, TableMismatches);
+
+        TestEqual(FString::Printf(TEXT("%s: locked map round-trips"), Mode), LockedMismatches, 0);
+        TestEqual(FString::Printf(TEXT("%s: compact table round-trips"), Mode), TableMismatches, 0);
+        AddInfo(FString::Printf(TEXT("%s, %d GUIDs x %d passes: locked map %.0f ns, compact table %.0f ns per round trip (%.1fx)"),
+            Mode, Guids.Num(), Passes, LockedNs, TableNs, LockedNs / FMath::Max(TableNs, 0.001)));
+    }
+
+END_DEFINE_SPEC(FMCPCompactGuidBenchmark)
+
+void FMCPCompactGuidBenchmark::Define()
+{
+    BeforeEach([this]()
+    {
+        if (Guids.Num() > 0)
+        {
+            return;
+        }
+
+        Guids.Reserve(100000);
+        for (int32 i = 0; i < 100000; ++i)
+        {
+            Guids.Add(FGuid::NewGuid());
+        }
+    });
+
+    It("Single thread", [this]() { Compare(false); });
+    It("ParallelFor", [this]() { Compare(true); });
+
+    It("EncodeIndex vs FBase64", [this]()
+    {
+        constexpr int32 Count = 1000000;
+        int32 Checksum = 0;
+
+        double Start = FPlatformTime::Seconds();
+        for (int32 i = 0; i < Count; ++i)
+        {
+            uint8 Bytes[3] = { (uint8)(i >> 16), (uint8)(i >> 8), (uint8)i };
+            Checksum += FBase64::Encode(Bytes, 3).Len();
+        }
+        const double Base64Ns = (FPlatformTime::Seconds() - Start) * 1e9 / Count;
+
+        Start = FPlatformTime::Seconds();
+        for (int32 i = 0; i < Count; ++i)
+        {
+            TCHAR Buffer[FMCPCompactGuidTable::MaxCompactLen];
+            Checksum += FMCPCompactGuidTable::EncodeIndex(i, Buffer);
+        }
+        const double EncodeNs = (FPlatformTime::Seconds() - Start) * 1e9 / Count;
+
+        TestTrue("Encoded something", Checksum > 0);
+        AddInfo(FString::Printf(TEXT("%d indices: FBase64 %.1f ns, EncodeIndex %.1f ns per index (%.1fx)"),
+            Count, Base64Ns, EncodeNs, Base64Ns / FMath::Max(EncodeNs, 0.001)));
+    });
+}
@@ -0,0 +1,90 @@
+#include "Misc/AutomationTest.h"
+#include "MCPSearchPatterns.h"
+#include "Internationalization/Regex.h"
+
+/**
+ * Compares the native glob matcher against ICU regex on a synthetic asset-name list.
+ * Timings are reported with AddInfo; run with "Automation RunTests Plugins.LervikMCP.Benchmark".
+ */
+BEGIN_DEFINE_SPEC(FMCPSearchPatternsBenchmark, "Plugins.LervikMCP.Benchmark.SearchPatterns",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+    TArray<FString> Names;
+
+    /** Nanoseconds per value for Func over Count values. Returns the number of matches through OutMatches. */
+    template<typename TFunc>
+    double TimePerValue(int32 Count, int32& OutMatches, TFunc&& Func)
+    {
+        OutMatches = 0;
+        const double Start = FPlatformTime::Seconds();
+        for (int32 i = 0; i < Count; ++i)
+        {
+            OutMatches += Func(Names[i]) ? 1 : 0;
+        }
+        return (FPlatformTime::Seconds() - Start) * 1e9 / FMath::Max(1, Count);
+    }
+
+    void Compare(const FString& Pattern)
+    {
+        // Compiling a regex per value is what Matches() did before patterns were cached; keep that run short.
+        const int32 PerCallCount = FMath::Min(Names.Num(), 20000);
+
+        int32 PerCallMatches = 0;
+        const double PerCallNs = TimePerValue(PerCallCount, PerCallMatches, [&Pattern](const FString& Name)
+        {
+            FRegexPattern Regex(FMCPSearchPatterns::WildcardToRegex(Pattern), ERegexPatternFlags::CaseInsensitive);
+            FRegexMatcher Matcher(Regex, Name);
+            return Matcher.FindNext();
+        });
+
+        const FRegexPattern Compiled(FMCPSearchPatterns::WildcardToRegex(Pattern), ERegexPatternFlags::CaseInsensitive);
+        int32 RegexMatches = 0;
+        const double RegexNs = TimePerValue(Names.Num(), RegexMatches, [&Compiled](const FString& Name)
+        {
+            FRegexMatcher Matcher(Compiled, Name);
+            return Matcher.FindNext();
+        });
+
+        const FMCPCompiledPattern Native = FMCPSearchPatterns::Compile(Pattern);
+        int32 NativeMatches = 0;
+        const double NativeNs = TimePerValue(Names.Num(), NativeMatches, [&Native](const FString& Name)
+        {
+            return Native.Matches(Name);
+        });
+
+        TestEqual(FString::Printf(TEXT("'%s' native and regex agree"), *Pattern), NativeMatches, RegexMatches);
+        AddInfo(FString::Printf(TEXT("'%s' over %d names: regex per call %.0f ns, regex compiled %.0f ns, native %.1f ns per name (%.1fx vs compiled, %d matches)"),
+            *Pattern, Names.Num(), PerCallNs, RegexNs, NativeNs, RegexNs / FMath::Max(NativeNs, 0.001), NativeMatches));
+    }
+
+END_DEFINE_SPEC(FMCPSearchPatternsBenchmark)
+
+void FMCPSearchPatternsBenchmark::Define()
+{
+    BeforeEach([this]()
+    {
+        if (Names.Num() > 0)
+        {
+            return;
+        }
+
+        static const TCHAR* Prefixes[] = { TEXT("SM_"), TEXT("M_"), TEXT("MI_"), TEXT("T_"), TEXT("BP_"), TEXT("NS_") };
+        static const TCHAR* Words[] = { TEXT("Rock"), TEXT("Door"), TEXT("Light"), TEXT("Wall"), TEXT("Floor"), TEXT("Tree"), TEXT("Lamp"), TEXT("Crate") };
+
+        FRandomStream Random(1234);
+        Names.Reserve(200000);
+        for (int32 i = 0; i < 200000; ++i)
+        {
+            Names.Add(FString::Printf(TEXT("%s%s_%s_%05d"),
+                Prefixes[Random.RandHelper(UE_ARRAY_COUNT(Prefixes))],
+                Words[Random.RandHelper(UE_ARRAY_COUNT(Words))],
+                Words[Random.RandHelper(UE_ARRAY_COUNT(Words))],
+                i));
+        }
+    });
+
+    It("Prefix glob", [this]() { Compare(TEXT("M_*")); });
+    It("Substring glob", [this]() { Compare(TEXT("*Light*")); });
+    It("Single-character glob", [this]() { Compare(TEXT("BP_?oor")); });
+    It("Comma alternatives", [this]() { Compare(TEXT("SM_*Rock*, T_*Tree*")); });
+}
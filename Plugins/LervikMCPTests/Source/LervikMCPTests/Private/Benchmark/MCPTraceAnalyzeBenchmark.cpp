@@ -0,0 +1,410 @@
+#include "Misc/AutomationTest.h"
+#include "Integration/MCPToolDirectTestHelper.h"
+#include "Containers/Ticker.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Modules/ModuleManager.h"
+#include "TraceServices/ITraceServicesModule.h"
+#include "TraceServices/AnalysisService.h"
+#include "TraceServices/Model/AnalysisSession.h"
+#include "TraceServices/Model/Threads.h"
+#include "TraceServices/Model/TimingProfiler.h"
+#include "Tools/TraceTimingArena.h"
+
+namespace
+{
+    /** One game-thread timing event, with its timer index resolved the way FTraceAnalyzer resolves it. */
+    struct FReplayEvent
+    {
+        double Start;
+        double End;
+        uint32 Depth;
+        uint32 TimerIndex;
+    };
+
+    /** Reads the game-thread timeline once, so both tree builders replay identical input. */
+    bool ReadGameThreadEvents(const FString& TracePath, TArray<FReplayEvent>& OutEvents, TMap<uint32, FString>& OutTimerNames)
+    {
+        ITraceServicesModule& TraceServicesModule = FModuleManager::LoadModuleChecked<ITraceServicesModule>(TEXT("TraceServices"));
+        TSharedPtr<TraceServices::IAnalysisService> AnalysisService = TraceServicesModule.GetAnalysisService();
+        if (!AnalysisService.IsValid())
+        {
+            return false;
+        }
+        TSharedPtr<const TraceServices::IAnalysisSession> Session = AnalysisService->StartAnalysis(*TracePath);
+        if (!Session.IsValid())
+        {
+            return false;
+        }
+        Session->Wait();
+
+        TraceServices::FAnalysisSessionReadScope ReadScope(*Session);
+        const TraceServices::ITimingProfilerProvider* TimingProvider = TraceServices::ReadTimingProfilerProvider(*Session);
+        if (!TimingProvider)
+        {
+            return false;
+        }
+
+        TimingProvider->ReadTimers([&](const TraceServices::ITimingProfilerTimerReader& Reader)
+        {
+            for (uint32 i = 0; i < Reader.GetTimerCount(); ++i)
+            {
+                const TraceServices::FTimingProfilerTimer* Timer = Reader.GetTimer(i);
+                if (Timer && Timer->Name)
+                {
+                    OutTimerNames.Add(i, FString(Timer->Name));
+                }
+            }
+        });
+
+        uint32 GameThreadId = 0;
+        bool bFoundGameThread = false;
+        TraceServices::ReadThreadProvider(*Session).EnumerateThreads([&](const TraceServices::FThreadInfo& Thread)
+        {
+            if (!bFoundGameThread && FCString::Stristr(Thread.Name, TEXT("GameThread")))
+            {
+                GameThreadId = Thread.Id;
+                bFoundGameThread = true;
+            }
+        });
+
+        uint32 TimelineIndex = 0;
+        if (!bFoundGameThread || !TimingProvider->GetCpuThreadTimelineIndex(GameThreadId, TimelineIndex))
+        {
+            return false;
+        }
+
+        TimingProvider->ReadTimeline(TimelineIndex, [&](const TraceServices::ITimingProfilerProvider::Timeline& Timeline)
+        {
+            Timeline.EnumerateEvents(Timeline.GetStartTime(), Timeline.GetEndTime(),
+                [&](double Start, double End, uint32 Depth, const TraceServices::FTimingProfilerEvent& Event) -> TraceServices::EEventEnumerate
+                {
+                    uint32 TimerIndex = Event.TimerIndex;
+#if !UE_VERSION_OLDER_THAN(5, 7, 0)
+                    TimerIndex = TimingProvider->GetOriginalTimerIdFromMetadata(TimerIndex);
+#endif
+                    OutEvents.Add({ Start, End, Depth, TimerIndex });
+                    return TraceServices::EEventEnumerate::Continue;
+                });
+        });
+        return OutEvents.Num() > 0;
+    }
+
+    /**
+     * The builder trace analyze used before FTraceTimingArena: a Name_N string per event, a TMap of FString
+     * per parent and a linear search of the parent's children. Kept here only to measure the arena against.
+     */
+    int32 BuildLegacyTree(const TArray<FReplayEvent>& Events, const TMap<uint32, FString>& TimerNames, FTraceTimingNode& Root)
+    {
+        int32 TopLevelCount = 0;
+        TMap<FTraceTimingNode*, TMap<FString, int32>> SeenCounts;
+        TArray<FTraceTimingNode*> Stack;
+        Stack.Push(&Root);
+
+        for (const FReplayEvent& Event : Events)
+        {
+            if (Event.Depth == 0)
+            {
+                TopLevelCount++;
+                SeenCounts.Reset();
+                Stack.SetNum(1);
+            }
+            else
+            {
+                while (Stack.Num() > (int32)(Event.Depth + 1) && Stack.Num() > 1)
+                    Stack.Pop();
+            }
+
+            FTraceTimingNode* Parent = Stack.Last();
+
+            FString BaseName;
+            if (const FString* Found = TimerNames.Find(Event.TimerIndex))
+                BaseName = *Found;
+            else
+                BaseName = FString::Printf(TEXT("Timer_%u"), Event.TimerIndex);
+
+            TMap<FString, int32>& ParentSeen = SeenCounts.FindOrAdd(Parent);
+            int32& SeenCount = ParentSeen.FindOrAdd(BaseName);
+            FString NodeName = SeenCount == 0
+                ? BaseName
+                : FString::Printf(TEXT("%s_%d"), *BaseName, SeenCount);
+            SeenCount++;
+
+            FTraceTimingNode* Node = nullptr;
+            for (auto& Child : Parent->Children)
+            {
+                if (Child.Name == NodeName) { Node = &Child; break; }
+            }
+            if (!Node)
+            {
+                Parent->Children.Emplace();
+                Node = &Parent->Children.Last();
+                Node->Name = NodeName;
+            }
+
+            // Histograms weren't there yet; they are added here so both builders do the same per-sample work.
+            double DurationMs = (Event.End - Event.Start) * 1000.0;
+            if (FMath::IsFinite(DurationMs) && DurationMs >= 0.0)
+            {
+                Node->Count++;
+                Node->TotalMs += DurationMs;
+                Node->MinMs = FMath::Min(Node->MinMs, DurationMs);
+                Node->MaxMs = FMath::Max(Node->MaxMs, DurationMs);
+                Node->Histogram.Add(DurationMs);
+            }
+
+            Stack.Push(Node);
+        }
+        return TopLevelCount;
+    }
+
+    /** BuildTimingTree's per-event steps over a single chunk, including interning the names and ToTree. */
+    int32 BuildArenaTree(const TArray<FReplayEvent>& Events, const TMap<uint32, FString>& TimerNameMap, FTraceTimingNode& Root)
+    {
+        FTraceTimerNames TimerNames;
+        for (const TPair<uint32, FString>& Timer : TimerNameMap)
+        {
+            TimerNames.SetTimer(Timer.Key, *Timer.Value);
+        }
+
+        FTraceTimingArena Arena;
+        int32 TopLevelCount = 0;
+        TMap<uint64, uint32> SeenCounts;
+        TArray<int32, TInlineAllocator<64>> Stack;
+        Stack.Push(FTraceTimingArena::RootIndex);
+
+        for (const FReplayEvent& Event : Events)
+        {
+            if (Event.Depth == 0)
+            {
+                TopLevelCount++;
+                SeenCounts.Reset();
+                Stack.SetNum(1);
+            }
+            else
+            {
+                while (Stack.Num() > (int32)(Event.Depth + 1) && Stack.Num() > 1)
+                    Stack.Pop();
+            }
+
+            const int32 Parent = Stack.Last();
+            const uint32 NameId = TimerNames.GetNameId(Event.TimerIndex);
+            uint32& SeenCount = SeenCounts.FindOrAdd(((uint64)(uint32)Parent << 32) | NameId);
+            const int32 Node = Arena.FindOrAddChild(Parent, NameId, SeenCount++);
+
+            double DurationMs = (Event.End - Event.Start) * 1000.0;
+            if (FMath::IsFinite(DurationMs) && DurationMs >= 0.0)
+                Arena.AddSample(Node, DurationMs);
+
+            Stack.Push(Node);
+        }
+
+        Arena.ToTree(TimerNames, Root);
+        return TopLevelCount;
+    }
+
+    /** Same names, counts and child order all the way down. */
+    bool SameTree(const FTraceTimingNode& A, const FTraceTimingNode& B, int32& InOutNodes)
+    {
+        ++InOutNodes;
+        if (A.Name != B.Name || A.Count != B.Count || A.Children.Num() != B.Children.Num())
+        {
+            return false;
+        }
+        for (int32 i = 0; i < A.Children.Num(); ++i)
+        {
+            if (!SameTree(A.Children[i], B.Children[i], InOutNodes))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+/**
+ * Times trace analyze on a 60-second capture: a full read through TraceServices, a re-query served from
+ * the in-memory cache and one served from the .utrace.mcpsum summary. Records the capture itself unless
+ * -MCPBenchTrace=<path.utrace> points at an existing one. The game-thread events are also replayed through
+ * the timing-tree builder and the TMap<FString> builder it replaced, on the same input. Timings are reported with AddInfo.
+ */
+BEGIN_DEFINE_SPEC(FMCPTraceAnalyzeBenchmark, "Plugins.LervikMCP.Benchmark.TraceAnalyze",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+    static constexpr double CaptureSeconds = 60.0;
+    static constexpr int32 Passes = 3;
+
+    /** Best of Passes wall times in ms for one analyze call; 0 on error. */
+    double TimeAnalyze(IMCPTool* TraceTool, const FString& TracePath, TSharedPtr<FJsonObject>& OutJson)
+    {
+        double BestMs = TNumericLimits<double>::Max();
+        for (int32 Pass = 0; Pass < Passes; ++Pass)
+        {
+            const double Start = FPlatformTime::Seconds();
+            FMCPToolResult Result = TraceTool->Execute(FMCPToolDirectTestHelper::MakeParams({
+                { TEXT("action"), TEXT("analyze") },
+                { TEXT("path"),   TracePath },
+                { TEXT("depth"),  TEXT("3") },
+            }));
+            const double ElapsedMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+            if (Result.bIsError)
+            {
+                AddError(FString::Printf(TEXT("analyze failed: %s"), *Result.Content));
+                return 0.0;
+            }
+            OutJson = FMCPToolDirectTestHelper::ParseResultJson(Result);
+            BestMs = FMath::Min(BestMs, ElapsedMs);
+        }
+        return BestMs;
+    }
+
+    /** Best of Passes for each tree builder over the same game-thread events. */
+    void CompareTreeBuilders(const FString& TracePath)
+    {
+        TArray<FReplayEvent> Events;
+        TMap<uint32, FString> TimerNames;
+        if (!TestTrue("game-thread events read", ReadGameThreadEvents(TracePath, Events, TimerNames)))
+        {
+            return;
+        }
+
+        double LegacyMs = TNumericLimits<double>::Max();
+        double ArenaMs = TNumericLimits<double>::Max();
+        FTraceTimingNode LegacyRoot;
+        FTraceTimingNode ArenaRoot;
+        for (int32 Pass = 0; Pass < Passes; ++Pass)
+        {
+            LegacyRoot = FTraceTimingNode();
+            double Start = FPlatformTime::Seconds();
+            const int32 LegacyFrames = BuildLegacyTree(Events, TimerNames, LegacyRoot);
+            LegacyMs = FMath::Min(LegacyMs, (FPlatformTime::Seconds() - Start) * 1000.0);
+
+            ArenaRoot = FTraceTimingNode();
+            Start = FPlatformTime::Seconds();
+            const int32 ArenaFrames = BuildArenaTree(Events, TimerNames, ArenaRoot);
+            ArenaMs = FMath::Min(ArenaMs, (FPlatformTime::Seconds() - Start) * 1000.0);
+
+            TestEqual("same frame count", ArenaFrames, LegacyFrames);
+        }
+
+        int32 Nodes = 0;
+        TestTrue("arena tree matches the legacy tree", SameTree(LegacyRoot, ArenaRoot, Nodes));
+        AddInfo(FString::Printf(TEXT("Tree builder, best of %d over %d game-thread events (%d nodes): TMap<FString> %.1f ms, arena %.1f ms (%.2fx)"),
+            Passes, Events.Num(), Nodes, LegacyMs, ArenaMs, LegacyMs / FMath::Max(ArenaMs, 0.001)));
+    }
+
+    void RunBenchmark(const FString& TracePath)
+    {
+        IMCPTool* TraceTool = FMCPToolDirectTestHelper::FindTool(TEXT("trace"));
+        IConsoleVariable* CacheMB = IConsoleManager::Get().FindConsoleVariable(TEXT("mcp.trace_cache_mb"));
+        IConsoleVariable* SummaryFiles = IConsoleManager::Get().FindConsoleVariable(TEXT("mcp.trace_summary_files"));
+        if (!TestNotNull("trace tool found", TraceTool) || !TestNotNull("cvars exist", CacheMB) || !TestNotNull("cvars exist", SummaryFiles))
+        {
+            return;
+        }
+
+        const int32 PreviousCacheMB = CacheMB->GetInt();
+        const int32 PreviousSummaryFiles = SummaryFiles->GetInt();
+        ON_SCOPE_EXIT
+        {
+            CacheMB->Set(PreviousCacheMB, ECVF_SetByCode);
+            SummaryFiles->Set(PreviousSummaryFiles, ECVF_SetByCode);
+        };
+
+        // Every call reads the trace.
+        CacheMB->Set(0, ECVF_SetByCode);
+        SummaryFiles->Set(0, ECVF_SetByCode);
+        TSharedPtr<FJsonObject> Json;
+        const double ReadMs = TimeAnalyze(TraceTool, TracePath, Json);
+        if (!Json.IsValid())
+        {
+            return;
+        }
+
+        // The first call reads and writes the summary, the rest come from memory.
+        CacheMB->Set(FMath::Max(PreviousCacheMB, 256), ECVF_SetByCode);
+        SummaryFiles->Set(1, ECVF_SetByCode);
+        const double CachedMs = TimeAnalyze(TraceTool, TracePath, Json);
+
+        // Memory cache off again: every call maps the summary.
+        CacheMB->Set(0, ECVF_SetByCode);
+        const double SummaryMs = TimeAnalyze(TraceTool, TracePath, Json);
+
+        const double Frames = Json.IsValid() ? Json->GetNumberField(TEXT("frame_count")) : 0.0;
+        const double CpuFrames = Json.IsValid() ? Json->GetNumberField(TEXT("cpu_frame_count")) : 0.0;
+        const double RenderPasses = Json.IsValid() ? Json->GetNumberField(TEXT("render_frame_count")) : 0.0;
+        TestTrue("trace has frames", Frames > 0.0);
+
+        AddInfo(FString::Printf(TEXT("%s: %.0f frames, %.0f CPU frames, %.0f render passes"),
+            *FPaths::GetCleanFilename(TracePath), Frames, CpuFrames, RenderPasses));
+        AddInfo(FString::Printf(TEXT("Best of %d: read trace %.1f ms (%.3f ms/frame), memory cache %.2f ms, summary file %.2f ms"),
+            Passes, ReadMs, ReadMs / FMath::Max(Frames, 1.0), CachedMs, SummaryMs));
+
+        CompareTreeBuilders(TracePath);
+
+        IFileManager::Get().Delete(*(FPaths::ConvertRelativePathToFull(TracePath) + TEXT(".mcpsum")), false, false, true);
+    }
+
+END_DEFINE_SPEC(FMCPTraceAnalyzeBenchmark)
+
+void FMCPTraceAnalyzeBenchmark::Define()
+{
+    LatentIt("Analyze a 60-second trace", FTimespan::FromSeconds(CaptureSeconds + 180.0), [this](const FDoneDelegate& Done)
+    {
+        FString ExistingTrace;
+        if (FParse::Value(FCommandLine::Get(), TEXT("MCPBenchTrace="), ExistingTrace))
+        {
+            RunBenchmark(ExistingTrace);
+            Done.Execute();
+            return;
+        }
+
+        IMCPTool* TraceTool = FMCPToolDirectTestHelper::FindTool(TEXT("trace"));
+        if (!TestNotNull("trace tool found", TraceTool))
+        {
+            Done.Execute();
+            return;
+        }
+
+        const FString CapturePath = FPaths::ProjectSavedDir() / FString::Printf(
+            TEXT("Profiling/MCPBenchmark_%s.utrace"), *FGuid::NewGuid().ToString());
+        FMCPToolResult StartResult = TraceTool->Execute(
+            FMCPToolDirectTestHelper::MakeParams({ { TEXT("action"), TEXT("start") }, { TEXT("path"), CapturePath } }));
+        if (!TestFalse("start is not an error", StartResult.bIsError))
+        {
+            Done.Execute();
+            return;
+        }
+
+        // Let the editor tick for the whole capture so the trace has real frames.
+        const double CaptureEnd = FPlatformTime::Seconds() + CaptureSeconds;
+        FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this, Done, TraceTool, CapturePath, CaptureEnd](float)
+        {
+            if (FPlatformTime::Seconds() < CaptureEnd)
+            {
+                return true;
+            }
+
+            FMCPToolResult StopResult = TraceTool->Execute(
+                FMCPToolDirectTestHelper::MakeParams({ { TEXT("action"), TEXT("stop") } }));
+            FString TracePath = CapturePath;
+            if (TSharedPtr<FJsonObject> StopJson = FMCPToolDirectTestHelper::ParseResultJson(StopResult))
+            {
+                StopJson->TryGetStringField(TEXT("path"), TracePath);
+            }
+
+            if (TestFalse("stop is not an error", StopResult.bIsError))
+            {
+                RunBenchmark(TracePath);
+            }
+            IFileManager::Get().Delete(*TracePath, false, false, true);
+            Done.Execute();
+            return false;
+        }));
+    });
+}
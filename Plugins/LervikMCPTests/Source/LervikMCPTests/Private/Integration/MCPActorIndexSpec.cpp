@@ -0,0 +1,95 @@
+#include "Misc/AutomationTest.h"
+#include "MCPToolDirectTestHelper.h"
+#include "MCPActorIndex.h"
+#include "MCPObjectResolver.h"
+#include "Engine/StaticMeshActor.h"
+#include "Components/SceneComponent.h"
+
+BEGIN_DEFINE_SPEC(FMCPActorIndexSpec, "Plugins.LervikMCP.Integration.ActorIndex",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+	FMCPToolDirectTestHelper Helper;
+END_DEFINE_SPEC(FMCPActorIndexSpec)
+
+void FMCPActorIndexSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		Helper.Setup(this);
+	});
+
+	AfterEach([this]()
+	{
+		Helper.Cleanup();
+	});
+
+	It("resolves actors by label and by internal name", [this]()
+	{
+		AActor* Actor = Helper.SpawnTransientActor(AStaticMeshActor::StaticClass());
+		if (!TestNotNull("actor spawned", Actor)) return;
+		Actor->SetActorLabel(TEXT("MCPActorIndex_Label"));
+
+		FString Error;
+		TestEqual("by label, any case", FMCPObjectResolver::ResolveActor(TEXT("mcpactorindex_label"), Error), Actor);
+		TestEqual("by internal name", FMCPObjectResolver::ResolveActor(Actor->GetName(), Error), Actor);
+	});
+
+	It("follows label changes and deletions", [this]()
+	{
+		AActor* Actor = Helper.SpawnTransientActor(AStaticMeshActor::StaticClass());
+		if (!TestNotNull("actor spawned", Actor)) return;
+		Actor->SetActorLabel(TEXT("MCPActorIndex_Before"));
+
+		FString Error;
+		TestEqual("old label resolves", FMCPObjectResolver::ResolveActor(TEXT("MCPActorIndex_Before"), Error), Actor);
+
+		Actor->SetActorLabel(TEXT("MCPActorIndex_After"));
+		TestEqual("new label resolves", FMCPActorIndex::Get().Find(TEXT("MCPActorIndex_After")), Actor);
+		TestNull("old label is gone", FMCPActorIndex::Get().Find(TEXT("MCPActorIndex_Before")));
+
+		const int32 CountBefore = FMCPActorIndex::Get().Num();
+		GEditor->GetEditorSubsystem<UEditorActorSubsystem>()->DestroyActor(Actor);
+		TestNull("deleted actor is gone", FMCPObjectResolver::ResolveActor(TEXT("MCPActorIndex_After"), Error));
+		TestEqual("index shrank", FMCPActorIndex::Get().Num(), CountBefore - 1);
+		TestEqual("error names the target", Error, FString(TEXT("Actor 'MCPActorIndex_After' not found")));
+	});
+
+	It("refreshes bounds when a component's transform is edited", [this]()
+	{
+		AActor* Actor = Helper.SpawnTransientActor(AStaticMeshActor::StaticClass());
+		if (!TestNotNull("actor spawned", Actor)) return;
+
+		const FVector Far(200000.0, 0.0, 0.0);
+		const FBox FarBox = FBox::BuildAABB(Far, FVector(100.0));
+		auto IsInFarBox = [&FarBox, Actor]()
+		{
+			bool bFound = false;
+			FMCPActorIndex::Get().ForEachActorInBox(FarBox, [&bFound, Actor](AActor* Found) { bFound |= Found == Actor; });
+			return bFound;
+		};
+		TestFalse("not indexed at the far location yet", IsInFarBox());
+
+		// What the details panel does: set the property, then broadcast the change on the component
+		USceneComponent* Root = Actor->GetRootComponent();
+		if (!TestNotNull("root component", Root)) return;
+		Root->SetRelativeLocation(Far);
+		Root->PostEditChange();
+		TestTrue("found at the new location", IsInFarBox());
+	});
+
+	It("rebuilds after Invalidate for moves that fire no event", [this]()
+	{
+		AActor* Actor = Helper.SpawnTransientActor(AStaticMeshActor::StaticClass());
+		if (!TestNotNull("actor spawned", Actor)) return;
+
+		const FVector Far(-200000.0, 0.0, 0.0);
+		const FBox FarBox = FBox::BuildAABB(Far, FVector(100.0));
+		FMCPActorIndex::Get().Num();
+
+		Actor->SetActorLocation(Far);
+		FMCPActorIndex::Get().Invalidate();
+
+		bool bFound = false;
+		FMCPActorIndex::Get().ForEachActorInBox(FarBox, [&bFound, Actor](AActor* Found) { bFound |= Found == Actor; });
+		TestTrue("found at the new location", bFound);
+	});
+}
@@ -0,0 +1,53 @@
+#include "Misc/AutomationTest.h"
+#include "MCPToolDirectTestHelper.h"
+#include "MCPClassIndex.h"
+#include "Engine/StaticMeshActor.h"
+
+BEGIN_DEFINE_SPEC(FMCPClassIndexSpec, "Plugins.LervikMCP.Integration.ClassIndex",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+	FMCPToolDirectTestHelper Helper;
+END_DEFINE_SPEC(FMCPClassIndexSpec)
+
+void FMCPClassIndexSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		Helper.Setup(this);
+	});
+
+	AfterEach([this]()
+	{
+		Helper.Cleanup();
+	});
+
+	It("resolves short names and paths like FindFirstObject", [this]()
+	{
+		TestEqual("short name", FMCPClassIndex::Get().FindClass(TEXT("StaticMeshActor")), AStaticMeshActor::StaticClass());
+		TestEqual("any case", FMCPClassIndex::Get().FindClass(TEXT("staticmeshactor")), AStaticMeshActor::StaticClass());
+		TestEqual("path", FMCPClassIndex::Get().FindClass(AStaticMeshActor::StaticClass()->GetPathName()), AStaticMeshActor::StaticClass());
+		TestNull("unknown", FMCPClassIndex::Get().FindClass(TEXT("NoSuchClass_ZZZ_MCP")));
+	});
+
+	It("lists derived classes transitively", [this]()
+	{
+		TArray<UClass*> Derived;
+		FMCPClassIndex::Get().GetDerivedClasses(AActor::StaticClass(), Derived);
+		TestTrue("grandchild included", Derived.Contains(AStaticMeshActor::StaticClass()));
+		TestFalse("parent excluded", Derived.Contains(AActor::StaticClass()));
+		TestFalse("unrelated excluded", Derived.Contains(UMaterial::StaticClass()));
+	});
+
+	It("picks up newly compiled Blueprint classes", [this]()
+	{
+		TestTrue("index built", FMCPClassIndex::Get().Num() > 0);
+
+		UBlueprint* BP = Helper.CreateTransientBlueprint(TEXT("BP_MCPClassIndexTest"));
+		if (!TestNotNull("blueprint created", BP) || !TestNotNull("generated class", BP->GeneratedClass.Get())) return;
+
+		TestEqual("resolves by name", FMCPClassIndex::Get().FindClass(BP->GeneratedClass->GetName()), BP->GeneratedClass.Get());
+
+		TArray<UClass*> Derived;
+		FMCPClassIndex::Get().GetDerivedClasses(AActor::StaticClass(), Derived);
+		TestTrue("listed under its parent", Derived.Contains(BP->GeneratedClass.Get()));
+	});
+}
@@ -0,0 +1,148 @@
+#include "Misc/AutomationTest.h"
+#include "MCPJsonHelpers.h"
+#include "MCPPropertyPlanCache.h"
+#include "MCPToolDirectTestHelper.h"
+#include "Components/PointLightComponent.h"
+#include "Engine/StaticMeshActor.h"
+
+BEGIN_DEFINE_SPEC(FMCPPropertyPlanCacheSpec, "Plugins.LervikMCP.Integration.PropertyPlanCache",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+	UPointLightComponent* Light = nullptr;
+	FMCPToolDirectTestHelper Helper;
+END_DEFINE_SPEC(FMCPPropertyPlanCacheSpec)
+
+void FMCPPropertyPlanCacheSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		Helper.Setup(this);
+		FMCPPropertyPlanCache::Get().Reset();
+		Light = NewObject<UPointLightComponent>(GetTransientPackage());
+		Light->AddToRoot();
+	});
+
+	AfterEach([this]()
+	{
+		Light->RemoveFromRoot();
+		Light = nullptr;
+		FMCPPropertyPlanCache::Get().Reset();
+		Helper.Cleanup();
+	});
+
+	It("builds one plan per class", [this]()
+	{
+		UPointLightComponent* Other = NewObject<UPointLightComponent>(GetTransientPackage());
+		FMCPJsonHelpers::UObjectToJson(Light, TEXT("Intensity"));
+		FMCPJsonHelpers::UObjectToJson(Other, TEXT("Attenuation*"));
+		TestEqual("one plan", FMCPPropertyPlanCache::Get().NumPlans(), 1);
+	});
+
+	It("applies the filter the same way with a cached plan", [this]()
+	{
+		for (int32 Pass = 0; Pass < 2; ++Pass)
+		{
+			FMCPPropertyPlanCache::Get().InvalidateObject(Light);
+			TSharedPtr<FJsonObject> Json = FMCPJsonHelpers::UObjectToJson(Light, TEXT("Intensity"));
+			TestTrue(FString::Printf(TEXT("pass %d has Intensity"), Pass), Json->HasField(TEXT("Intensity")));
+			TestFalse(FString::Printf(TEXT("pass %d skips AttenuationRadius"), Pass), Json->HasField(TEXT("AttenuationRadius")));
+		}
+	});
+
+	It("returns a copy of the snapshot", [this]()
+	{
+		TSharedPtr<FJsonObject> First = FMCPJsonHelpers::UObjectToJson(Light, TEXT("Intensity"));
+		First->SetStringField(TEXT("_added"), TEXT("x"));
+		TSharedPtr<FJsonObject> Second = FMCPJsonHelpers::UObjectToJson(Light, TEXT("Intensity"));
+		TestEqual("snapshot stored", FMCPPropertyPlanCache::Get().NumSnapshots(), 1);
+		TestFalse("caller edits don't leak", Second->HasField(TEXT("_added")));
+		TestTrue("values kept", Second->HasField(TEXT("Intensity")));
+	});
+
+	It("returns a deep copy of nested objects", [this]()
+	{
+		TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+		TSharedRef<FJsonObject> Nested = MakeShared<FJsonObject>();
+		Nested->SetNumberField(TEXT("X"), 1.0);
+		Json->SetObjectField(TEXT("Location"), Nested);
+		FMCPPropertyPlanCache::Get().AddSnapshot(Light, TEXT("Location"), false, Json);
+		Nested->SetNumberField(TEXT("X"), 2.0);
+
+		TSharedPtr<FJsonObject> First = FMCPPropertyPlanCache::Get().FindSnapshot(Light, TEXT("Location"), false);
+		if (!TestTrue("snapshot found", First.IsValid())) return;
+		TestEqual("stored before the caller's edit", First->GetObjectField(TEXT("Location"))->GetNumberField(TEXT("X")), 1.0);
+		First->GetObjectField(TEXT("Location"))->SetNumberField(TEXT("X"), 3.0);
+
+		TSharedPtr<FJsonObject> Second = FMCPPropertyPlanCache::Get().FindSnapshot(Light, TEXT("Location"), false);
+		TestEqual("nested edits don't leak", Second->GetObjectField(TEXT("Location"))->GetNumberField(TEXT("X")), 1.0);
+	});
+
+	It("keeps filtered entries valid across more filters than it caches", [this]()
+	{
+		const TSharedRef<FMCPPropertyPlan> Plan = FMCPPropertyPlanCache::Get().GetPlan(UPointLightComponent::StaticClass());
+		for (int32 i = 0; i < 40; ++i)
+		{
+			Plan->GetEntries(FString::Printf(TEXT("Filler%d"), i));
+		}
+
+		const TSharedRef<const FMCPPropertyPlan::FEntryList> Intensity = Plan->GetEntries(TEXT("Intensity"));
+		const int32 NumIntensity = Intensity->Num();
+		Plan->GetEntries(TEXT("Attenuation*"));
+		TestTrue("matched Intensity", NumIntensity > 0);
+		TestEqual("unchanged by a later filter", Intensity->Num(), NumIntensity);
+		TestEqual("still Intensity", (*Intensity)[0]->JsonKey, FString(TEXT("Intensity")));
+	});
+
+	It("re-reads a component after the modify tool moves its actor", [this]()
+	{
+		IMCPTool* InspectTool = FMCPToolDirectTestHelper::FindTool(TEXT("inspect"));
+		IMCPTool* ModifyTool = FMCPToolDirectTestHelper::FindTool(TEXT("modify"));
+		if (!TestNotNull("inspect tool", InspectTool) || !TestNotNull("modify tool", ModifyTool)) return;
+
+		AActor* Actor = Helper.SpawnTransientActor(AStaticMeshActor::StaticClass());
+		if (!TestNotNull("actor spawned", Actor) || !TestNotNull("root component", Actor->GetRootComponent())) return;
+
+		const FString Target = Actor->GetActorLabel() + TEXT(".") + Actor->GetRootComponent()->GetName();
+		auto InspectLocation = [&]()
+		{
+			return InspectTool->Execute(FMCPToolDirectTestHelper::MakeParams({
+				{ TEXT("target"), Target },
+				{ TEXT("type"),   TEXT("properties") },
+				{ TEXT("filter"), TEXT("RelativeLocation") },
+				{ TEXT("detail"), TEXT("all") },
+			})).GetText();
+		};
+
+		const FString Before = InspectLocation();
+		FMCPToolResult ModifyResult = ModifyTool->Execute(FMCPToolDirectTestHelper::MakeParamsFromJson(FString::Printf(
+			TEXT("{\"target\":\"%s\",\"transform\":{\"location\":[120,340,560]}}"), *Actor->GetActorLabel())));
+		if (!TestFalse("modify succeeded", ModifyResult.bIsError)) return;
+
+		const FString After = InspectLocation();
+		TestNotEqual("location changed", After, Before);
+
+		FMCPPropertyPlanCache::Get().Reset();
+		TestEqual("matches a fresh read", After, InspectLocation());
+	});
+
+	It("re-reads the object after an editor property change", [this]()
+	{
+		FMCPJsonHelpers::UObjectToJson(Light, TEXT("Intensity"));
+
+		Light->Intensity = 1234.0f;
+		FPropertyChangedEvent Event(FindFProperty<FProperty>(UPointLightComponent::StaticClass(), TEXT("Intensity")));
+		FCoreUObjectDelegates::OnObjectPropertyChanged.Broadcast(Light, Event);
+		TestEqual("snapshot dropped", FMCPPropertyPlanCache::Get().NumSnapshots(), 0);
+
+		TSharedPtr<FJsonObject> Json = FMCPJsonHelpers::UObjectToJson(Light, TEXT("Intensity"));
+		TestEqual("new value", Json->GetNumberField(TEXT("Intensity")), 1234.0);
+	});
+
+	It("keeps snapshots apart per filter and skip_defaults", [this]()
+	{
+		FMCPJsonHelpers::UObjectToJson(Light, TEXT("Intensity"));
+		FMCPJsonHelpers::UObjectToJson(Light, TEXT("Intensity"), true);
+		TSharedPtr<FJsonObject> All = FMCPJsonHelpers::UObjectToJson(Light);
+		TestEqual("three snapshots", FMCPPropertyPlanCache::Get().NumSnapshots(), 3);
+		TestTrue("unfiltered has AttenuationRadius", All->HasField(TEXT("AttenuationRadius")));
+	});
+}
@@ -10,6 +10,7 @@
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "HAL/ThreadSafeCounter.h"
+#include "Containers/Ticker.h"
 
 static const uint32 IntTestPort = 13370;
 static const FString IntTestUrl = TEXT("http://127.0.0.1:13370/mcp");
@@ -43,6 +44,12 @@ public:
         }
         return FMCPToolResult::Text(TEXT("no message"));
     }
+
+    virtual TFuture<FMCPToolResult> ExecuteAsync(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context) override
+    {
+        Context.ReportProgress(1, 2, TEXT("halfway"));
+        return MakeFulfilledPromise<FMCPToolResult>(Execute(Params)).GetFuture();
+    }
 };
 
 // Slow mock tool — sleeps in Execute to simulate long-running work
@@ -68,11 +75,45 @@ public:
     }
 };
 
+// Worker-thread tool that runs until its request is cancelled
+class FMCPServerSpecCancellableTool : public IMCPTool
+{
+public:
+    virtual FMCPToolInfo GetToolInfo() const override
+    {
+        FMCPToolInfo Info;
+        Info.Name = TEXT("cancellable_tool");
+        Info.Description = TEXT("Runs until cancelled");
+        Info.bRunsOnGameThread = false;
+        return Info;
+    }
+
+    virtual FMCPToolResult Execute(const TSharedPtr<FJsonObject>& Params) override
+    {
+        return ExecuteAsync(Params, FMCPToolContext()).Get();
+    }
+
+    virtual TFuture<FMCPToolResult> ExecuteAsync(const TSharedPtr<FJsonObject>& Params, const FMCPToolContext& Context) override
+    {
+        const double Timeout = FPlatformTime::Seconds() + 5.0;
+        while (FPlatformTime::Seconds() < Timeout)
+        {
+            if (Context.IsCancelled())
+            {
+                return MakeFulfilledPromise<FMCPToolResult>(FMCPToolResult::Cancelled()).GetFuture();
+            }
+            FPlatformProcess::Sleep(0.01f);
+        }
+        return MakeFulfilledPromise<FMCPToolResult>(FMCPToolResult::Text(TEXT("not cancelled"))).GetFuture();
+    }
+};
+
 BEGIN_DEFINE_SPEC(FMCPServerSpec, "Plugins.LervikMCP.Integration.Server",
     EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
     TUniquePtr<FMCPServer> Server;
     TUniquePtr<FMCPServerSpecMockTool> MockTool;
     TUniquePtr<FMCPServerSpecSlowTool> SlowTool;
+    TUniquePtr<FMCPServerSpecCancellableTool> CancellableTool;
     bool bMockToolRegistered = false;
     bool bSlowToolRegistered = false;
     int32 BaselineToolCount = 0;
@@ -135,6 +176,11 @@ void FMCPServerSpec::Define()
             bSlowToolRegistered = false;
         }
         SlowTool.Reset();
+        if (CancellableTool.IsValid())
+        {
+            IModularFeatures::Get().UnregisterModularFeature(IMCPTool::GetModularFeatureName(), CancellableTool.Get());
+            CancellableTool.Reset();
+        }
         if (Server.IsValid())
         {
             Server->Stop();
@@ -332,6 +378,52 @@ void FMCPServerSpec::Define()
         InitRequest->ProcessRequest();
     });
 
+    LatentIt("tools/list ETag is stable and changes when a tool is registered", FTimespan::FromSeconds(10.0),
+        [this](const FDoneDelegate& Done)
+    {
+        const FString ListBody = TEXT("{\"jsonrpc\":\"2.0\",\"id\":\"list-1\",\"method\":\"tools/list\",\"params\":{}}");
+        auto FirstRequest = MakePost(ListBody);
+        FirstRequest->OnProcessRequestComplete().BindLambda([this, Done, ListBody](FHttpRequestPtr, FHttpResponsePtr FirstResponse, bool bFirstSuccess)
+        {
+            if (!bFirstSuccess || !FirstResponse.IsValid())
+            {
+                AddError(TEXT("First tools/list failed"));
+                Done.Execute();
+                return;
+            }
+
+            const FString FirstETag = FirstResponse->GetHeader(TEXT("ETag"));
+            TestFalse("ETag present", FirstETag.IsEmpty());
+
+            TSharedPtr<FJsonObject> JsonObj;
+            TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FirstResponse->GetContentAsString());
+            if (FJsonSerializer::Deserialize(Reader, JsonObj) && JsonObj.IsValid())
+            {
+                FString Id;
+                JsonObj->TryGetStringField(TEXT("id"), Id);
+                TestEqual("String id echoed", Id, TEXT("list-1"));
+                TestTrue("Has result", JsonObj->HasField(TEXT("result")));
+            }
+
+            MockTool = MakeUnique<FMCPServerSpecMockTool>();
+            IModularFeatures::Get().RegisterModularFeature(IMCPTool::GetModularFeatureName(), MockTool.Get());
+            bMockToolRegistered = true;
+
+            auto SecondRequest = MakePost(ListBody);
+            SecondRequest->OnProcessRequestComplete().BindLambda([this, Done, FirstETag](FHttpRequestPtr, FHttpResponsePtr SecondResponse, bool bSecondSuccess)
+            {
+                TestTrue("Second tools/list succeeded", bSecondSuccess);
+                if (bSecondSuccess && SecondResponse.IsValid())
+                {
+                    TestNotEqual("ETag changed after registration", SecondResponse->GetHeader(TEXT("ETag")), FirstETag);
+                }
+                Done.Execute();
+            });
+            SecondRequest->ProcessRequest();
+        });
+        FirstRequest->ProcessRequest();
+    });
+
     LatentIt("tools/call with mock tool returns echoed result", FTimespan::FromSeconds(10.0),
         [this](const FDoneDelegate& Done)
     {
@@ -385,6 +477,179 @@ void FMCPServerSpec::Define()
         InitRequest->ProcessRequest();
     });
 
+    LatentIt("tools/call with progressToken and SSE accept returns batched progress before the result", FTimespan::FromSeconds(10.0),
+        [this](const FDoneDelegate& Done)
+    {
+        MockTool = MakeUnique<FMCPServerSpecMockTool>();
+        IModularFeatures::Get().RegisterModularFeature(IMCPTool::GetModularFeatureName(), MockTool.Get());
+        bMockToolRegistered = true;
+
+        auto Request = MakePost(TEXT("{\"jsonrpc\":\"2.0\",\"id\":9,\"method\":\"tools/call\",\"params\":{\"name\":\"test_tool\",\"arguments\":{\"message\":\"sse\"},\"_meta\":{\"progressToken\":\"p1\"}}}"));
+        Request->SetHeader(TEXT("Accept"), TEXT("application/json, text/event-stream"));
+        Request->OnProcessRequestComplete().BindLambda([this, Done](FHttpRequestPtr, FHttpResponsePtr Response, bool bSuccess)
+        {
+            TestTrue("HTTP request succeeded", bSuccess);
+            if (bSuccess && Response.IsValid())
+            {
+                TestEqual("Status 200", Response->GetResponseCode(), 200);
+                TestTrue("Event stream content type", Response->GetContentType().StartsWith(TEXT("text/event-stream")));
+
+                const FString Body = Response->GetContentAsString();
+                const int32 ProgressPos = Body.Find(TEXT("notifications/progress"));
+                const int32 ResultPos = Body.Find(TEXT("echo: sse"));
+                TestTrue("Has progress event", ProgressPos != INDEX_NONE);
+                TestTrue("Has result event", ResultPos != INDEX_NONE);
+                TestTrue("Progress precedes result", ProgressPos < ResultPos);
+                TestTrue("Progress carries the token", Body.Contains(TEXT("\"p1\"")));
+            }
+            Done.Execute();
+        });
+        Request->ProcessRequest();
+    });
+
+    LatentIt("tools/call with progressToken but JSON-only accept returns plain JSON", FTimespan::FromSeconds(10.0),
+        [this](const FDoneDelegate& Done)
+    {
+        MockTool = MakeUnique<FMCPServerSpecMockTool>();
+        IModularFeatures::Get().RegisterModularFeature(IMCPTool::GetModularFeatureName(), MockTool.Get());
+        bMockToolRegistered = true;
+
+        auto Request = MakePost(TEXT("{\"jsonrpc\":\"2.0\",\"id\":10,\"method\":\"tools/call\",\"params\":{\"name\":\"test_tool\",\"arguments\":{\"message\":\"json\"},\"_meta\":{\"progressToken\":\"p2\"}}}"));
+        Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
+        Request->OnProcessRequestComplete().BindLambda([this, Done](FHttpRequestPtr, FHttpResponsePtr Response, bool bSuccess)
+        {
+            TestTrue("HTTP request succeeded", bSuccess);
+            if (bSuccess && Response.IsValid())
+            {
+                TestTrue("JSON content type", Response->GetContentType().StartsWith(TEXT("application/json")));
+                TestFalse("No progress events", Response->GetContentAsString().Contains(TEXT("notifications/progress")));
+            }
+            Done.Execute();
+        });
+        Request->ProcessRequest();
+    });
+
+    LatentIt("notifications/cancelled stops a running tools/call", FTimespan::FromSeconds(10.0),
+        [this](const FDoneDelegate& Done)
+    {
+        CancellableTool = MakeUnique<FMCPServerSpecCancellableTool>();
+        IModularFeatures::Get().RegisterModularFeature(IMCPTool::GetModularFeatureName(), CancellableTool.Get());
+
+        const double StartTime = FPlatformTime::Seconds();
+        auto CallRequest = MakePost(TEXT("{\"jsonrpc\":\"2.0\",\"id\":\"cancel-me\",\"method\":\"tools/call\",\"params\":{\"name\":\"cancellable_tool\",\"arguments\":{}}}"));
+        CallRequest->OnProcessRequestComplete().BindLambda([this, Done, StartTime](FHttpRequestPtr, FHttpResponsePtr Response, bool bSuccess)
+        {
+            TestTrue("HTTP request succeeded", bSuccess);
+            if (bSuccess && Response.IsValid())
+            {
+                TestTrue("Reports cancellation", Response->GetContentAsString().Contains(TEXT("Request cancelled")));
+                TestTrue("Returned before the tool timed out", FPlatformTime::Seconds() - StartTime < 4.0);
+            }
+            Done.Execute();
+        });
+        CallRequest->ProcessRequest();
+
+        // Give the call time to reach a worker before cancelling it.
+        FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float)
+        {
+            auto CancelRequest = MakePost(TEXT("{\"jsonrpc\":\"2.0\",\"method\":\"notifications/cancelled\",\"params\":{\"requestId\":\"cancel-me\",\"reason\":\"test\"}}"));
+            CancelRequest->ProcessRequest();
+            return false;
+        }), 0.5f);
+    });
+
+    LatentIt("Stop() returns while a trace test call still needs the game thread", FTimespan::FromSeconds(60.0),
+        [this](const FDoneDelegate& Done)
+    {
+        // trace test sleeps 5s, starts a trace on the game thread, sleeps 5s and stops it on the game thread.
+        // Stopping after 1s lets the drain loop time out before the second game-thread call is queued.
+        auto CallRequest = MakePost(TEXT("{\"jsonrpc\":\"2.0\",\"id\":\"trace-test\",\"method\":\"tools/call\",\"params\":{\"name\":\"trace\",\"arguments\":{\"action\":\"test\"}}}"));
+        CallRequest->ProcessRequest();
+
+        FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this, Done](float)
+        {
+            const double StopStart = FPlatformTime::Seconds();
+            Server->Stop();
+            TestFalse("Server stopped", Server->IsRunning());
+            TestTrue("Stop() waited for the tool, not forever", FPlatformTime::Seconds() - StopStart < 30.0);
+            Server.Reset();
+            Done.Execute();
+            return false;
+        }), 1.0f);
+    });
+
+    LatentIt("Batch request returns one response per non-notification entry", FTimespan::FromSeconds(10.0),
+        [this](const FDoneDelegate& Done)
+    {
+        MockTool = MakeUnique<FMCPServerSpecMockTool>();
+        IModularFeatures::Get().RegisterModularFeature(IMCPTool::GetModularFeatureName(), MockTool.Get());
+        bMockToolRegistered = true;
+
+        FString BatchBody = TEXT("[")
+            TEXT("{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"tools/call\",\"params\":{\"name\":\"test_tool\",\"arguments\":{\"message\":\"a\"}}},")
+            TEXT("{\"jsonrpc\":\"2.0\",\"method\":\"notifications/initialized\"},")
+            TEXT("{\"jsonrpc\":\"2.0\",\"id\":2,\"method\":\"tools/call\",\"params\":{\"name\":\"test_tool\",\"arguments\":{\"message\":\"b\"}}},")
+            TEXT("{\"jsonrpc\":\"2.0\",\"id\":3,\"method\":\"ping\"}")
+            TEXT("]");
+        auto Request = MakePost(BatchBody);
+        Request->OnProcessRequestComplete().BindLambda([this, Done](FHttpRequestPtr, FHttpResponsePtr Response, bool bSuccess)
+        {
+            TestTrue("HTTP request succeeded", bSuccess);
+            if (bSuccess && Response.IsValid())
+            {
+                TestEqual("Status 200", Response->GetResponseCode(), 200);
+                TArray<TSharedPtr<FJsonValue>> Entries;
+                TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+                if (FJsonSerializer::Deserialize(Reader, Entries))
+                {
+                    TestEqual("Three responses", Entries.Num(), 3);
+                    TMap<int32, FString> TextById;
+                    for (const TSharedPtr<FJsonValue>& Entry : Entries)
+                    {
+                        TSharedPtr<FJsonObject> Obj = Entry->AsObject();
+                        int32 Id = 0;
+                        Obj->TryGetNumberField(TEXT("id"), Id);
+                        const TSharedPtr<FJsonObject>* Result = nullptr;
+                        const TArray<TSharedPtr<FJsonValue>>* Content = nullptr;
+                        if (Obj->TryGetObjectField(TEXT("result"), Result) && (*Result)->TryGetArrayField(TEXT("content"), Content) && Content->Num() > 0)
+                        {
+                            TextById.Add(Id, (*Content)[0]->AsObject()->GetStringField(TEXT("text")));
+                        }
+                        else
+                        {
+                            TextById.Add(Id, FString());
+                        }
+                    }
+                    TestEqual("Call 1 result", TextById.FindRef(1), TEXT("echo: a"));
+                    TestEqual("Call 2 result", TextById.FindRef(2), TEXT("echo: b"));
+                    TestTrue("Ping answered", TextById.Contains(3));
+                }
+                else
+                {
+                    AddError(TEXT("Batch response is not a JSON array"));
+                }
+            }
+            Done.Execute();
+        });
+        Request->ProcessRequest();
+    });
+
+    LatentIt("Batch of only notifications returns 202", FTimespan::FromSeconds(10.0),
+        [this](const FDoneDelegate& Done)
+    {
+        auto Request = MakePost(TEXT("[{\"jsonrpc\":\"2.0\",\"method\":\"notifications/initialized\"}]"));
+        Request->OnProcessRequestComplete().BindLambda([this, Done](FHttpRequestPtr, FHttpResponsePtr Response, bool bSuccess)
+        {
+            TestTrue("HTTP request succeeded", bSuccess);
+            if (bSuccess && Response.IsValid())
+            {
+                TestEqual("Status 202", Response->GetResponseCode(), 202);
+            }
+            Done.Execute();
+        });
+        Request->ProcessRequest();
+    });
+
     LatentIt("tools/call with unknown tool returns error -32601", FTimespan::FromSeconds(10.0),
         [this](const FDoneDelegate& Done)
     {
@@ -427,7 +692,7 @@ void FMCPServerSpec::Define()
     LatentIt("should accept notifications silently", FTimespan::FromSeconds(10.0),
         [this](const FDoneDelegate& Done)
     {
-        // Notifications are handled before the session guard, so no init needed
+        // Without an Mcp-Session-Id header the static session is used, so no init needed
         FString NotifBody = TEXT("{\"jsonrpc\":\"2.0\",\"method\":\"notifications/initialized\"}");
         auto NotifRequest = MakePost(NotifBody);
         NotifRequest->OnProcessRequestComplete().BindLambda([this, Done](FHttpRequestPtr /*Req*/, FHttpResponsePtr NotifResponse, bool bNotifSuccess)
@@ -584,6 +849,111 @@ void FMCPServerSpec::Define()
         InitRequest->ProcessRequest();
     });
 
+    LatentIt("initialize twice returns two sessions that both stay usable", FTimespan::FromSeconds(10.0),
+        [this](const FDoneDelegate& Done)
+    {
+        auto FirstInit = MakePost(MakeInitBody());
+        FirstInit->OnProcessRequestComplete().BindLambda([this, Done](FHttpRequestPtr /*Req*/, FHttpResponsePtr FirstResponse, bool bFirstSuccess)
+        {
+            if (!bFirstSuccess || !FirstResponse.IsValid())
+            {
+                AddError(TEXT("First initialize failed"));
+                Done.Execute();
+                return;
+            }
+            const FString FirstId = FirstResponse->GetHeader(TEXT("Mcp-Session-Id"));
+
+            auto SecondInit = MakePost(MakeInitBody());
+            SecondInit->OnProcessRequestComplete().BindLambda([this, Done, FirstId](FHttpRequestPtr /*Req*/, FHttpResponsePtr SecondResponse, bool bSecondSuccess)
+            {
+                if (!bSecondSuccess || !SecondResponse.IsValid())
+                {
+                    AddError(TEXT("Second initialize failed"));
+                    Done.Execute();
+                    return;
+                }
+                const FString SecondId = SecondResponse->GetHeader(TEXT("Mcp-Session-Id"));
+                TestFalse("Second session id present", SecondId.IsEmpty());
+                TestNotEqual("Distinct session ids", SecondId, FirstId);
+                TestEqual("Server tracks both plus the static session", Server->GetSessionSnapshots().Num(), 3);
+
+                auto PingFirst = MakePost(TEXT("{\"jsonrpc\":\"2.0\",\"id\":3,\"method\":\"ping\"}"), FirstId);
+                PingFirst->OnProcessRequestComplete().BindLambda([this, Done, FirstId](FHttpRequestPtr /*Req*/, FHttpResponsePtr PingResponse, bool bPingSuccess)
+                {
+                    TestTrue("Ping succeeded", bPingSuccess);
+                    if (bPingSuccess && PingResponse.IsValid())
+                    {
+                        TestEqual("First session still valid", PingResponse->GetResponseCode(), 200);
+                        TestEqual("Answered in the first session", PingResponse->GetHeader(TEXT("Mcp-Session-Id")), FirstId);
+                    }
+                    Done.Execute();
+                });
+                PingFirst->ProcessRequest();
+            });
+            SecondInit->ProcessRequest();
+        });
+        FirstInit->ProcessRequest();
+    });
+
+    LatentIt("unknown Mcp-Session-Id returns 404", FTimespan::FromSeconds(10.0),
+        [this](const FDoneDelegate& Done)
+    {
+        const FString UnknownId = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphens);
+        auto Request = MakePost(TEXT("{\"jsonrpc\":\"2.0\",\"id\":2,\"method\":\"tools/list\",\"params\":{}}"), UnknownId);
+        Request->OnProcessRequestComplete().BindLambda([this, Done](FHttpRequestPtr /*Req*/, FHttpResponsePtr Response, bool bSuccess)
+        {
+            TestTrue("HTTP request succeeded", bSuccess);
+            if (bSuccess && Response.IsValid())
+            {
+                TestEqual("Status 404", Response->GetResponseCode(), 404);
+            }
+            Done.Execute();
+        });
+        Request->ProcessRequest();
+    });
+
+    LatentIt("DELETE /mcp ends the session", FTimespan::FromSeconds(10.0),
+        [this](const FDoneDelegate& Done)
+    {
+        auto InitRequest = MakePost(MakeInitBody());
+        InitRequest->OnProcessRequestComplete().BindLambda([this, Done](FHttpRequestPtr /*Req*/, FHttpResponsePtr InitResponse, bool bInitSuccess)
+        {
+            if (!bInitSuccess || !InitResponse.IsValid())
+            {
+                AddError(TEXT("Initialize request failed"));
+                Done.Execute();
+                return;
+            }
+            const FString SessionId = InitResponse->GetHeader(TEXT("Mcp-Session-Id"));
+
+            auto DeleteRequest = FHttpModule::Get().CreateRequest();
+            DeleteRequest->SetURL(IntTestUrl);
+            DeleteRequest->SetVerb(TEXT("DELETE"));
+            DeleteRequest->SetHeader(TEXT("Mcp-Session-Id"), SessionId);
+            DeleteRequest->OnProcessRequestComplete().BindLambda([this, Done, SessionId](FHttpRequestPtr /*Req*/, FHttpResponsePtr DeleteResponse, bool bDeleteSuccess)
+            {
+                TestTrue("DELETE succeeded", bDeleteSuccess);
+                if (bDeleteSuccess && DeleteResponse.IsValid())
+                {
+                    TestEqual("Status 200", DeleteResponse->GetResponseCode(), 200);
+                }
+
+                auto PingRequest = MakePost(TEXT("{\"jsonrpc\":\"2.0\",\"id\":3,\"method\":\"ping\"}"), SessionId);
+                PingRequest->OnProcessRequestComplete().BindLambda([this, Done](FHttpRequestPtr /*Req*/, FHttpResponsePtr PingResponse, bool bPingSuccess)
+                {
+                    if (bPingSuccess && PingResponse.IsValid())
+                    {
+                        TestEqual("Ended session is not found", PingResponse->GetResponseCode(), 404);
+                    }
+                    Done.Execute();
+                });
+                PingRequest->ProcessRequest();
+            });
+            DeleteRequest->ProcessRequest();
+        });
+        InitRequest->ProcessRequest();
+    });
+
     It("Stop() completes safely with in-flight async tool execution", [this]()
     {
         SlowTool = MakeUnique<FMCPServerSpecSlowTool>();
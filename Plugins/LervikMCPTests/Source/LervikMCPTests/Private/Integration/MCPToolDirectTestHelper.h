@@ -96,7 +96,7 @@ public:
 	static TSharedPtr<FJsonObject> ParseResultJson(const FMCPToolResult& Result)
 	{
 		TSharedPtr<FJsonObject> Obj;
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Result.Content);
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Result.GetText());
 		FJsonSerializer::Deserialize(Reader, Obj);
 		return Obj;
 	}
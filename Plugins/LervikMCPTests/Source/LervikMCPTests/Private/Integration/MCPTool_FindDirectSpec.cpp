@@ -1,5 +1,7 @@
 #include "Misc/AutomationTest.h"
 #include "MCPToolDirectTestHelper.h"
+#include "MCPAssetNameIndex.h"
+#include "Engine/StaticMeshActor.h"
 
 // M_Test.uasset exists at Content/M_Test.uasset -> /Game/M_Test in the Asset Registry
 static const FString KnownAssetName = TEXT("M_Test");
@@ -77,6 +79,117 @@ void FMCPTool_FindDirectSpec::Define()
 		});
 	});
 
+	Describe("asset name index", [this]()
+	{
+		It("finds a known asset by substring and glob", [this]()
+		{
+			if (!FMCPAssetNameIndex::Get().IsReady())
+			{
+				AddInfo(TEXT("Asset name index still building; skipped"));
+				return;
+			}
+
+			TArray<FMCPAssetNameIndex::FHit> Hits;
+			const FMCPCompiledPattern Substring[] = { FMCPSearchPatterns::Compile(TEXT("m_tes")) };
+			TestTrue("query ran", FMCPAssetNameIndex::Get().Query(Substring, 1000, Hits));
+			TestTrue("substring hit", Hits.ContainsByPredicate([](const FMCPAssetNameIndex::FHit& Hit)
+			{
+				return Hit.Name == KnownAssetName && Hit.PackageName == FName(TEXT("/Game/M_Test"));
+			}));
+
+			const FMCPCompiledPattern Glob[] = { FMCPSearchPatterns::Compile(TEXT("M_?est")) };
+			FMCPAssetNameIndex::Get().Query(Glob, 1000, Hits);
+			TestTrue("glob hit", Hits.ContainsByPredicate([](const FMCPAssetNameIndex::FHit& Hit) { return Hit.Name == KnownAssetName; }));
+
+			const FMCPCompiledPattern NoMatch[] = { FMCPSearchPatterns::Compile(TEXT("zzqx_no_such_asset")) };
+			FMCPAssetNameIndex::Get().Query(NoMatch, 1000, Hits);
+			TestEqual("no hits for unknown name", Hits.Num(), 0);
+		});
+
+		It("respects the limit", [this]()
+		{
+			TArray<FMCPAssetNameIndex::FHit> Hits;
+			const FMCPCompiledPattern MatchAll[] = { FMCPCompiledPattern() };
+			if (FMCPAssetNameIndex::Get().Query(MatchAll, 3, Hits))
+			{
+				TestTrue("at most 3 hits", Hits.Num() <= 3);
+			}
+		});
+	});
+
+	Describe("type=actor, spatial filters", [this]()
+	{
+		It("near keeps actors within radius, sorted by distance", [this]()
+		{
+			if (!TestNotNull("find tool found", FindTool)) return;
+
+			// Far from anything in the test level so only these actors are in range
+			const FVector Origin(900000.0, 900000.0, 0.0);
+			AActor* Close = Helper.SpawnTransientActor(AStaticMeshActor::StaticClass(), Origin + FVector(300.0, 0.0, 0.0));
+			AActor* Closest = Helper.SpawnTransientActor(AStaticMeshActor::StaticClass(), Origin + FVector(100.0, 0.0, 0.0));
+			AActor* Far = Helper.SpawnTransientActor(AStaticMeshActor::StaticClass(), Origin + FVector(5000.0, 0.0, 0.0));
+			if (!TestNotNull("actors spawned", Close) || !Closest || !Far) return;
+			Close->SetActorLabel(TEXT("MCPSpatial_Close"));
+			Closest->SetActorLabel(TEXT("MCPSpatial_Closest"));
+			Far->SetActorLabel(TEXT("MCPSpatial_Far"));
+
+			FMCPToolResult Result = FindTool->Execute(FMCPToolDirectTestHelper::MakeParamsFromJson(
+				TEXT("{\"type\":\"actor\",\"name\":\"MCPSpatial_*\",\"near\":[900000,900000,0],\"radius\":1000}")));
+			TestFalse("result is not an error", Result.bIsError);
+
+			TSharedPtr<FJsonObject> Json = FMCPToolDirectTestHelper::ParseResultJson(Result);
+			if (!TestNotNull("result parses as JSON", Json.Get())) return;
+			const TArray<TSharedPtr<FJsonValue>>& Results = Json->GetArrayField(TEXT("results"));
+			if (!TestEqual("two actors in range", Results.Num(), 2)) return;
+			TestEqual("closest first", Results[0]->AsObject()->GetStringField(TEXT("label")), TEXT("MCPSpatial_Closest"));
+			TestEqual("then close", Results[1]->AsObject()->GetStringField(TEXT("label")), TEXT("MCPSpatial_Close"));
+			TestTrue("distance reported", Results[0]->AsObject()->HasField(TEXT("distance")));
+		});
+
+		It("box finds an actor moved into it by the modify tool", [this]()
+		{
+			IMCPTool* ModifyTool = FMCPToolDirectTestHelper::FindTool(TEXT("modify"));
+			if (!TestNotNull("find tool found", FindTool) || !TestNotNull("modify tool found", ModifyTool)) return;
+
+			AActor* Actor = Helper.SpawnTransientActor(AStaticMeshActor::StaticClass(), FVector(-800000.0, 900000.0, 0.0));
+			if (!TestNotNull("actor spawned", Actor)) return;
+			Actor->SetActorLabel(TEXT("MCPSpatial_Mover"));
+
+			const TSharedPtr<FJsonObject> Params = FMCPToolDirectTestHelper::MakeParamsFromJson(
+				TEXT("{\"type\":\"actor\",\"name\":\"MCPSpatial_Mover\",\"box\":{\"min\":[-900100,899900,-100],\"max\":[-899900,900100,100]}}"));
+
+			TSharedPtr<FJsonObject> Json = FMCPToolDirectTestHelper::ParseResultJson(FindTool->Execute(Params));
+			if (!TestNotNull("result parses as JSON", Json.Get())) return;
+			TestEqual("outside the box", (int32)Json->GetNumberField(TEXT("count")), 0);
+
+			// No manual move event: the tool itself must refresh the spatial index
+			FMCPToolResult ModifyResult = ModifyTool->Execute(FMCPToolDirectTestHelper::MakeParamsFromJson(
+				TEXT("{\"target\":\"MCPSpatial_Mover\",\"transform\":{\"location\":[-900000,900000,0]}}")));
+			if (!TestFalse("modify is not an error", ModifyResult.bIsError)) return;
+
+			Json = FMCPToolDirectTestHelper::ParseResultJson(FindTool->Execute(Params));
+			if (!TestNotNull("result parses as JSON", Json.Get())) return;
+			TestEqual("moved into the box", (int32)Json->GetNumberField(TEXT("count")), 1);
+
+			ModifyResult = ModifyTool->Execute(FMCPToolDirectTestHelper::MakeParamsFromJson(
+				TEXT("{\"target\":\"MCPSpatial_Mover\",\"transform\":{\"location\":[-800000,900000,0]}}")));
+			if (!TestFalse("modify is not an error", ModifyResult.bIsError)) return;
+
+			Json = FMCPToolDirectTestHelper::ParseResultJson(FindTool->Execute(Params));
+			if (!TestNotNull("result parses as JSON", Json.Get())) return;
+			TestEqual("moved out of the box", (int32)Json->GetNumberField(TEXT("count")), 0);
+		});
+
+		It("rejects a malformed box", [this]()
+		{
+			if (!TestNotNull("find tool found", FindTool)) return;
+
+			FMCPToolResult Result = FindTool->Execute(FMCPToolDirectTestHelper::MakeParamsFromJson(
+				TEXT("{\"type\":\"actor\",\"box\":{\"min\":[0,0,0]}}")));
+			TestTrue("result is an error", Result.bIsError);
+		});
+	});
+
 	Describe("type=asset, class + path filter (regression)", [this]()
 	{
 		It("class=Material with game path returns no error", [this]()
@@ -1,11 +1,42 @@
 #include "Misc/AutomationTest.h"
 #include "MCPToolDirectTestHelper.h"
 #include "ProfilingDebugging/TraceAuxiliary.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeExit.h"
+#include "Tools/TraceAnalyzer.h"
 
 BEGIN_DEFINE_SPEC(FMCPTool_TraceDirectSpec, "Plugins.LervikMCP.Integration.Tools.Trace",
 	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
 	FMCPToolDirectTestHelper Helper;
 	IMCPTool* TraceTool = nullptr;
+	TArray<FString> RecordedTraces;
+
+	/** Records a short trace under Saved/Profiling and returns its path; AfterEach deletes it and its .mcpsum. */
+	FString RecordTrace(const TCHAR* Name)
+	{
+		FString UniquePath = FPaths::ProjectSavedDir() / FString::Printf(
+			TEXT("Profiling/%s_%s.utrace"), Name, *FGuid::NewGuid().ToString());
+
+		FMCPToolResult StartResult = TraceTool->Execute(
+			FMCPToolDirectTestHelper::MakeParams({ { TEXT("action"), TEXT("start") }, { TEXT("path"), UniquePath } })
+		);
+		if (!TestFalse("start is not an error", StartResult.bIsError)) return FString();
+		FPlatformProcess::Sleep(0.2f);
+		FMCPToolResult StopResult = TraceTool->Execute(
+			FMCPToolDirectTestHelper::MakeParams({ { TEXT("action"), TEXT("stop") } })
+		);
+		if (!TestFalse("stop is not an error", StopResult.bIsError)) return FString();
+		FPlatformProcess::Sleep(0.1f);
+
+		// The stop result carries the path actually written, which may differ from the requested one
+		FString TracePath = UniquePath;
+		TSharedPtr<FJsonObject> StopJson = FMCPToolDirectTestHelper::ParseResultJson(StopResult);
+		if (StopJson.IsValid())
+			StopJson->TryGetStringField(TEXT("path"), TracePath);
+		RecordedTraces.Add(TracePath);
+		return TracePath;
+	}
 END_DEFINE_SPEC(FMCPTool_TraceDirectSpec)
 
 void FMCPTool_TraceDirectSpec::Define()
@@ -14,6 +45,7 @@ void FMCPTool_TraceDirectSpec::Define()
 	{
 		Helper.Setup(this);
 		TraceTool = FMCPToolDirectTestHelper::FindTool(TEXT("trace"));
+		FTraceAnalyzer::ResetCache();
 		// Ensure any leftover trace is stopped before each test (via game thread).
 		if (TraceTool)
 			TraceTool->Execute(FMCPToolDirectTestHelper::MakeParams({ { TEXT("action"), TEXT("stop") } }));
@@ -26,6 +58,13 @@ void FMCPTool_TraceDirectSpec::Define()
 		if (TraceTool)
 			TraceTool->Execute(FMCPToolDirectTestHelper::MakeParams({ { TEXT("action"), TEXT("stop") } }));
 		TraceTool = nullptr;
+		FTraceAnalyzer::ResetCache();
+		for (const FString& TracePath : RecordedTraces)
+		{
+			IFileManager::Get().Delete(*TracePath);
+			IFileManager::Get().Delete(*(FPaths::ConvertRelativePathToFull(TracePath) + TEXT(".mcpsum")));
+		}
+		RecordedTraces.Reset();
 		Helper.Cleanup();
 	});
 
@@ -254,6 +293,29 @@ void FMCPTool_TraceDirectSpec::Define()
 			TestTrue("min_frame_time_ms >= 0", MinMs      >= 0.0);
 			TestTrue("max_frame_time_ms >= 0", MaxMs      >= 0.0);
 
+			double P50Ms = -1.0;
+			double P90Ms = -1.0;
+			double P99Ms = -1.0;
+			TestTrue("p50_frame_time_ms field present", Json->TryGetNumberField(TEXT("p50_frame_time_ms"), P50Ms));
+			TestTrue("p90_frame_time_ms field present", Json->TryGetNumberField(TEXT("p90_frame_time_ms"), P90Ms));
+			TestTrue("p99_frame_time_ms field present", Json->TryGetNumberField(TEXT("p99_frame_time_ms"), P99Ms));
+			TestTrue("percentiles are ordered", P50Ms <= P90Ms && P90Ms <= P99Ms);
+			TestTrue("p99_frame_time_ms <= max_frame_time_ms", P99Ms <= MaxMs);
+
+			// Histogram counts cover every frame
+			const TArray<TSharedPtr<FJsonValue>>* HistogramArray = nullptr;
+			if (TestTrue("frame_time_histogram field present", Json->TryGetArrayField(TEXT("frame_time_histogram"), HistogramArray)))
+			{
+				double HistogramFrames = 0.0;
+				for (const TSharedPtr<FJsonValue>& Bucket : *HistogramArray)
+				{
+					const TArray<TSharedPtr<FJsonValue>>& Pair = Bucket->AsArray();
+					if (TestEqual("histogram bucket is [upper_ms, count]", Pair.Num(), 2))
+						HistogramFrames += Pair[1]->AsNumber();
+				}
+				TestEqual("histogram counts sum to frame_count", HistogramFrames, FrameCount);
+			}
+
 			double RenderFrameCount = -1.0;
 			TestTrue("render_frame_count field present", Json->TryGetNumberField(TEXT("render_frame_count"), RenderFrameCount));
 			TestTrue("render_frame_count >= 0", RenderFrameCount >= 0.0);
@@ -270,6 +332,79 @@ void FMCPTool_TraceDirectSpec::Define()
 			TestTrue("cpu_frame_count field present", Json->TryGetNumberField(TEXT("cpu_frame_count"), CpuFrameCount));
 			TestTrue("cpu_frame_count >= 0", CpuFrameCount >= 0.0);
 		});
+
+		It("reuses the parsed trace when only depth or filter changes", [this]()
+		{
+			if (!TestNotNull("trace tool found", TraceTool)) return;
+
+			const FString TracePath = RecordTrace(TEXT("MCPAnalyzeCacheTest"));
+			if (TracePath.IsEmpty()) return;
+
+			FMCPToolResult First = TraceTool->Execute(
+				FMCPToolDirectTestHelper::MakeParams({ { TEXT("action"), TEXT("analyze") }, { TEXT("path"), TracePath } })
+			);
+			if (!TestFalse("first analyze is not an error", First.bIsError)) return;
+			FMCPToolResult Second = TraceTool->Execute(
+				FMCPToolDirectTestHelper::MakeParams({
+					{ TEXT("action"), TEXT("analyze") },
+					{ TEXT("path"),   TracePath },
+					{ TEXT("depth"),  TEXT("3") },
+					{ TEXT("filter"), TEXT("Frame") }
+				})
+			);
+			if (!TestFalse("second analyze is not an error", Second.bIsError)) return;
+
+			TSharedPtr<FJsonObject> FirstJson = FMCPToolDirectTestHelper::ParseResultJson(First);
+			TSharedPtr<FJsonObject> SecondJson = FMCPToolDirectTestHelper::ParseResultJson(Second);
+			if (!TestTrue("results parsed", FirstJson.IsValid() && SecondJson.IsValid())) return;
+
+			bool bFirstCached = true;
+			bool bSecondCached = false;
+			FirstJson->TryGetBoolField(TEXT("cached"), bFirstCached);
+			SecondJson->TryGetBoolField(TEXT("cached"), bSecondCached);
+			TestFalse("first analyze reads the file", bFirstCached);
+			TestTrue("second analyze reuses it", bSecondCached);
+			TestEqual("same frame_count", SecondJson->GetNumberField(TEXT("frame_count")), FirstJson->GetNumberField(TEXT("frame_count")));
+		});
+
+		It("writes a summary file and answers from it with the memory cache off", [this]()
+		{
+			if (!TestNotNull("trace tool found", TraceTool)) return;
+
+			IConsoleVariable* CacheMB = IConsoleManager::Get().FindConsoleVariable(TEXT("mcp.trace_cache_mb"));
+			if (!TestNotNull("mcp.trace_cache_mb exists", CacheMB)) return;
+			const int32 PreviousCacheMB = CacheMB->GetInt();
+			CacheMB->Set(0, ECVF_SetByCode);
+			ON_SCOPE_EXIT { CacheMB->Set(PreviousCacheMB, ECVF_SetByCode); };
+
+			const FString TracePath = RecordTrace(TEXT("MCPAnalyzeSummaryTest"));
+			if (TracePath.IsEmpty()) return;
+
+			FMCPToolResult First = TraceTool->Execute(
+				FMCPToolDirectTestHelper::MakeParams({ { TEXT("action"), TEXT("analyze") }, { TEXT("path"), TracePath } })
+			);
+			if (!TestFalse("first analyze is not an error", First.bIsError)) return;
+
+			const FString SummaryPath = FPaths::ConvertRelativePathToFull(TracePath) + TEXT(".mcpsum");
+			TestTrue("summary file written", IFileManager::Get().FileExists(*SummaryPath));
+
+			FMCPToolResult Second = TraceTool->Execute(
+				FMCPToolDirectTestHelper::MakeParams({ { TEXT("action"), TEXT("analyze") }, { TEXT("path"), TracePath } })
+			);
+			if (!TestFalse("second analyze is not an error", Second.bIsError)) return;
+
+			TSharedPtr<FJsonObject> FirstJson = FMCPToolDirectTestHelper::ParseResultJson(First);
+			TSharedPtr<FJsonObject> SecondJson = FMCPToolDirectTestHelper::ParseResultJson(Second);
+			if (!TestTrue("results parsed", FirstJson.IsValid() && SecondJson.IsValid())) return;
+
+			bool bSecondCached = false;
+			SecondJson->TryGetBoolField(TEXT("cached"), bSecondCached);
+			TestTrue("second analyze reads the summary", bSecondCached);
+			TestEqual("same frame_count", SecondJson->GetNumberField(TEXT("frame_count")), FirstJson->GetNumberField(TEXT("frame_count")));
+			TestEqual("same avg_frame_time_ms", SecondJson->GetNumberField(TEXT("avg_frame_time_ms")), FirstJson->GetNumberField(TEXT("avg_frame_time_ms")));
+			TestEqual("same p99_frame_time_ms", SecondJson->GetNumberField(TEXT("p99_frame_time_ms")), FirstJson->GetNumberField(TEXT("p99_frame_time_ms")));
+			TestEqual("same cpu_frame_count", SecondJson->GetNumberField(TEXT("cpu_frame_count")), FirstJson->GetNumberField(TEXT("cpu_frame_count")));
+		});
 	});
 
 	Describe("test action", [this]()
@@ -603,6 +738,10 @@ void FMCPTool_TraceDirectSpec::Define()
 				TestTrue(Context + TEXT(" has avg_ms (number)"), Node->TryGetNumberField(TEXT("avg_ms"), AvgMs));
 				TestTrue(Context + TEXT(" has min_ms (number)"), Node->TryGetNumberField(TEXT("min_ms"), NodeMinMs));
 				TestTrue(Context + TEXT(" has max_ms (number)"), Node->TryGetNumberField(TEXT("max_ms"), NodeMaxMs));
+				double P50Ms = -1.0, P99Ms = -1.0;
+				TestTrue(Context + TEXT(" has p50_ms (number)"), Node->TryGetNumberField(TEXT("p50_ms"), P50Ms));
+				TestTrue(Context + TEXT(" has p99_ms (number)"), Node->TryGetNumberField(TEXT("p99_ms"), P99Ms));
+				TestTrue(Context + TEXT(" p50_ms <= p99_ms <= max_ms"), P50Ms <= P99Ms && P99Ms <= NodeMaxMs);
 				const TArray<TSharedPtr<FJsonValue>>* NodeChildren = nullptr;
 				TestTrue(Context + TEXT(" has children (array)"), Node->TryGetArrayField(TEXT("children"), NodeChildren));
 			};
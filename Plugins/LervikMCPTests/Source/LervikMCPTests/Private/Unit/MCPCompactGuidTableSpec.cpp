@@ -0,0 +1,110 @@
+#include "Misc/AutomationTest.h"
+#include "MCPCompactGuidTable.h"
+#include "Async/ParallelFor.h"
+
+BEGIN_DEFINE_SPEC(FMCPCompactGuidTableSpec, "Plugins.LervikMCP.CompactGuidTable",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+    static FString Encode(int32 Index)
+    {
+        TCHAR Buffer[FMCPCompactGuidTable::MaxCompactLen];
+        return FString(FStringView(Buffer, FMCPCompactGuidTable::EncodeIndex(Index, Buffer)));
+    }
+
+END_DEFINE_SPEC(FMCPCompactGuidTableSpec)
+
+void FMCPCompactGuidTableSpec::Define()
+{
+    Describe("EncodeIndex", [this]()
+    {
+        It("Writes unpadded base64url of the minimal big-endian bytes", [this]()
+        {
+            TestEqual("0", Encode(0), TEXT("AA"));
+            TestEqual("1", Encode(1), TEXT("AQ"));
+            TestEqual("255", Encode(255), TEXT("_w"));
+            TestEqual("256", Encode(256), TEXT("AQA"));
+            TestEqual("Max length", Encode(MAX_int32).Len(), FMCPCompactGuidTable::MaxCompactLen);
+        });
+
+        It("Round-trips through DecodeIndex", [this]()
+        {
+            for (const int32 Index : { 0, 1, 62, 63, 255, 256, 65535, 65536, 16777215, 16777216, MAX_int32 })
+            {
+                int32 Decoded = -1;
+                TestTrue(FString::Printf(TEXT("%d decodes"), Index), FMCPCompactGuidTable::DecodeIndex(Encode(Index), Decoded));
+                TestEqual(FString::Printf(TEXT("%d round-trips"), Index), Decoded, Index);
+            }
+        });
+
+        It("Decodes the standard base64 alphabet and rejects garbage", [this]()
+        {
+            int32 Decoded = -1;
+            TestTrue("'/w' decodes", FMCPCompactGuidTable::DecodeIndex(TEXT("/w"), Decoded));
+            TestEqual("'/w' is 255", Decoded, 255);
+            TestTrue("Padded decodes", FMCPCompactGuidTable::DecodeIndex(TEXT("AQ=="), Decoded));
+            TestEqual("Padded is 1", Decoded, 1);
+            TestFalse("Invalid char", FMCPCompactGuidTable::DecodeIndex(TEXT("A!"), Decoded));
+            TestFalse("Too short", FMCPCompactGuidTable::DecodeIndex(TEXT("A"), Decoded));
+            TestFalse("Too long", FMCPCompactGuidTable::DecodeIndex(TEXT("AAAAAAAA"), Decoded));
+        });
+    });
+
+    Describe("Table", [this]()
+    {
+        It("Assigns sequential indices once per GUID", [this]()
+        {
+            FMCPCompactGuidTable Table;
+            const FGuid A = FGuid::NewGuid();
+            const FGuid B = FGuid::NewGuid();
+            TestEqual("First", Table.FindOrAdd(A), 0);
+            TestEqual("Second", Table.FindOrAdd(B), 1);
+            TestEqual("Repeat", Table.FindOrAdd(A), 0);
+            TestEqual("Num", Table.Num(), 2);
+            TestEqual("Get", Table.Get(1), B);
+            TestFalse("Unassigned index", Table.Get(2).IsValid());
+        });
+
+        It("Round-trips compact IDs and accepts raw GUIDs", [this]()
+        {
+            FMCPCompactGuidTable Table;
+            const FGuid Guid = FGuid::NewGuid();
+            TestEqual("Compact", Table.FromCompact(Table.ToCompact(Guid)), Guid);
+            TestEqual("Raw", Table.FromCompact(Guid.ToString(EGuidFormats::Digits)), Guid);
+            TestFalse("Unknown", Table.FromCompact(TEXT("_w")).IsValid());
+        });
+
+        It("Forgets everything on Reset", [this]()
+        {
+            FMCPCompactGuidTable Table;
+            const FString Compact = Table.ToCompact(FGuid::NewGuid());
+            Table.Reset();
+            TestEqual("Empty", Table.Num(), 0);
+            TestFalse("Old ID unresolvable", Table.FromCompact(Compact).IsValid());
+        });
+
+        It("Gives every GUID one index under concurrent inserts", [this]()
+        {
+            FMCPCompactGuidTable Table;
+            TArray<FGuid> Guids;
+            for (int32 i = 0; i < 5000; ++i)
+            {
+                Guids.Add(FGuid::NewGuid());
+            }
+
+            TArray<int32> Indices;
+            Indices.SetNumZeroed(Guids.Num() * 2);
+            ParallelFor(Indices.Num(), [&](int32 i)
+            {
+                Indices[i] = Table.FindOrAdd(Guids[i % Guids.Num()]);
+            });
+
+            TestEqual("Num", Table.Num(), Guids.Num());
+            bool bConsistent = true;
+            for (int32 i = 0; i < Guids.Num(); ++i)
+            {
+                bConsistent &= Indices[i] == Indices[i + Guids.Num()] && Table.Get(Indices[i]) == Guids[i];
+            }
+            TestTrue("Same index for both lookups and it maps back", bConsistent);
+        });
+    });
+}
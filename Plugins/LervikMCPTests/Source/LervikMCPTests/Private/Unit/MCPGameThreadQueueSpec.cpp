@@ -0,0 +1,73 @@
+#include "Misc/AutomationTest.h"
+#include "MCPGameThreadQueue.h"
+#include "MCPGameThreadHelper.h"
+#include "Async/Async.h"
+
+BEGIN_DEFINE_SPEC(FMCPGameThreadQueueSpec, "Plugins.LervikMCP.GameThreadQueue",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+END_DEFINE_SPEC(FMCPGameThreadQueueSpec)
+
+void FMCPGameThreadQueueSpec::Define()
+{
+    BeforeEach([this]()
+    {
+        // Start every test from an empty queue.
+        FMCPGameThreadQueue::Get().PumpAll();
+    });
+
+    It("Is running while the module is loaded", [this]()
+    {
+        TestTrue("Running", FMCPGameThreadQueue::Get().IsRunning());
+    });
+
+    It("Runs queued work in order", [this]()
+    {
+        FMCPGameThreadQueue& Queue = FMCPGameThreadQueue::Get();
+        TArray<int32> Order;
+        for (int32 i = 0; i < 3; ++i)
+        {
+            Queue.Enqueue([&Order, i]() { Order.Add(i); });
+        }
+
+        TestEqual("Pending before pump", Queue.GetPendingCount(), 3);
+        TestEqual("Ran all", Queue.PumpAll(), 3);
+        TestEqual("Pending after pump", Queue.GetPendingCount(), 0);
+        TestTrue("FIFO order", Order == TArray<int32>({ 0, 1, 2 }));
+    });
+
+    It("Runs at least one item with a zero budget", [this]()
+    {
+        FMCPGameThreadQueue& Queue = FMCPGameThreadQueue::Get();
+        int32 Ran = 0;
+        Queue.Enqueue([&Ran]() { FPlatformProcess::Sleep(0.002f); ++Ran; });
+        Queue.Enqueue([&Ran]() { ++Ran; });
+
+        TestEqual("One item per zero-budget pump", Queue.Pump(0.0), 1);
+        TestEqual("Ran", Ran, 1);
+        Queue.PumpAll();
+        TestEqual("Ran after drain", Ran, 2);
+    });
+
+    It("ExecuteOnGameThreadAsync runs inline on the game thread", [this]()
+    {
+        TFuture<FMCPToolResult> Future = ExecuteOnGameThreadAsync([]() { return FMCPToolResult::Text(TEXT("inline")); });
+        TestTrue("Ready without pumping", Future.IsReady());
+        TestEqual("Nothing queued", FMCPGameThreadQueue::Get().GetPendingCount(), 0);
+        TestEqual("Content", Future.Get().Content, TEXT("inline"));
+    });
+
+    LatentIt("Fulfils futures submitted from other threads on the game thread", FTimespan::FromSeconds(5.0),
+        [this](const FDoneDelegate& Done)
+    {
+        Async(EAsyncExecution::ThreadPool, [this, Done]()
+        {
+            TFuture<bool> Future = FMCPGameThreadQueue::Get().Submit([]() { return IsInGameThread(); });
+            const bool bRanOnGameThread = Future.Get();
+            AsyncTask(ENamedThreads::GameThread, [this, Done, bRanOnGameThread]()
+            {
+                TestTrue("Ran on game thread", bRanOnGameThread);
+                Done.Execute();
+            });
+        });
+    });
+}
@@ -0,0 +1,147 @@
+#include "Misc/AutomationTest.h"
+#include "MCPJsonWriter.h"
+#include "MCPTypes.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+BEGIN_DEFINE_SPEC(FMCPJsonWriterSpec, "Plugins.LervikMCP.JsonWriter",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+    static FString ToString(const TArray<uint8>& Utf8)
+    {
+        FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Utf8.GetData()), Utf8.Num());
+        return FString(Converted.Length(), Converted.Get());
+    }
+
+    static TSharedPtr<FJsonObject> ParseObject(const TArray<uint8>& Utf8)
+    {
+        TSharedPtr<FJsonObject> Object;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ToString(Utf8));
+        FJsonSerializer::Deserialize(Reader, Object);
+        return Object;
+    }
+
+END_DEFINE_SPEC(FMCPJsonWriterSpec)
+
+void FMCPJsonWriterSpec::Define()
+{
+    It("Separates nested values with commas", [this]()
+    {
+        FMCPJsonWriter Writer;
+        Writer.BeginObject();
+        Writer.WriteKey("a");
+        Writer.WriteInteger(1);
+        Writer.WriteKey(TEXT("b"));
+        Writer.BeginArray();
+        Writer.WriteBool(true);
+        Writer.WriteNull();
+        Writer.BeginObject();
+        Writer.EndObject();
+        Writer.EndArray();
+        Writer.WriteKey("c");
+        Writer.WriteString("x");
+        Writer.EndObject();
+
+        TestEqual("Output", ToString(Writer.Take()), TEXT("{\"a\":1,\"b\":[true,null,{}],\"c\":\"x\"}"));
+    });
+
+    It("Escapes TCHAR and UTF-8 strings the same way", [this]()
+    {
+        const FString Source = TEXT("quote\" slash\\ tab\t nl\n bell\x07 Blåbær");
+        FTCHARToUTF8 SourceUtf8(*Source, Source.Len());
+
+        FMCPJsonWriter Wide;
+        Wide.WriteString(Source);
+        FMCPJsonWriter Narrow;
+        Narrow.WriteUtf8String(TConstArrayView<uint8>(reinterpret_cast<const uint8*>(SourceUtf8.Get()), SourceUtf8.Length()));
+
+        const FString WideJson = ToString(Wide.Take());
+        TestEqual("Escaped", WideJson, TEXT("\"quote\\\" slash\\\\ tab\\t nl\\n bell\\u0007 Blåbær\""));
+        TestEqual("Same output from UTF-8", ToString(Narrow.Take()), WideJson);
+    });
+
+    It("Writes integral numbers without a fraction", [this]()
+    {
+        FMCPJsonWriter Writer;
+        Writer.BeginArray();
+        Writer.WriteNumber(42.0);
+        Writer.WriteNumber(-7.0);
+        Writer.WriteNumber(0.5);
+        Writer.EndArray();
+
+        TestEqual("Output", ToString(Writer.Take()), TEXT("[42,-7,0.5]"));
+    });
+
+    It("Writes fixed-point numbers like RoundedJsonNumber", [this]()
+    {
+        FMCPJsonWriter Writer;
+        Writer.BeginArray();
+        Writer.WriteFixed(5.0);
+        Writer.WriteFixed(1.23456, 3);
+        Writer.EndArray();
+
+        TestEqual("Output", ToString(Writer.Take()), TEXT("[5.00,1.235]"));
+    });
+
+    It("Round-trips a DOM object", [this]()
+    {
+        TSharedPtr<FJsonObject> Inner = MakeShared<FJsonObject>();
+        Inner->SetStringField(TEXT("name"), TEXT("Ünïcode"));
+        TSharedPtr<FJsonObject> Source = MakeShared<FJsonObject>();
+        Source->SetObjectField(TEXT("inner"), Inner);
+        Source->SetNumberField(TEXT("count"), 3);
+
+        FMCPJsonWriter Writer;
+        Writer.WriteObject(Source);
+        TSharedPtr<FJsonObject> Parsed = ParseObject(Writer.Take());
+        if (TestTrue("Parsed", Parsed.IsValid()))
+        {
+            TestEqual("count", Parsed->GetIntegerField(TEXT("count")), 3);
+            TestEqual("inner.name", Parsed->GetObjectField(TEXT("inner"))->GetStringField(TEXT("name")), FString(TEXT("Ünïcode")));
+        }
+    });
+
+    Describe("FMCPResponse::ToolCallSuccess", [this]()
+    {
+        It("Wraps Content in the tools/call envelope", [this]()
+        {
+            TSharedPtr<FJsonObject> Response = ParseObject(FMCPResponse::ToolCallSuccess(
+                MakeShared<FJsonValueNumber>(5), FMCPToolResult::Error(TEXT("{\"error\":\"boom\"}"))));
+            if (TestTrue("Parsed", Response.IsValid()))
+            {
+                TestEqual("id", Response->GetIntegerField(TEXT("id")), 5);
+                const TSharedPtr<FJsonObject> Result = Response->GetObjectField(TEXT("result"));
+                TestTrue("isError", Result->GetBoolField(TEXT("isError")));
+                const TArray<TSharedPtr<FJsonValue>>& Content = Result->GetArrayField(TEXT("content"));
+                if (TestEqual("One content item", Content.Num(), 1))
+                {
+                    TestEqual("text", Content[0]->AsObject()->GetStringField(TEXT("text")), TEXT("{\"error\":\"boom\"}"));
+                }
+            }
+        });
+
+        It("Escapes a UTF-8 payload written by the tool", [this]()
+        {
+            FMCPJsonWriter Payload;
+            Payload.BeginObject();
+            Payload.WriteKey("label");
+            Payload.WriteString(TEXT("Øst"));
+            Payload.EndObject();
+            const FMCPToolResult ToolResult = FMCPToolResult::Utf8(Payload.Take());
+            TestEqual("GetText decodes", ToolResult.GetText(), TEXT("{\"label\":\"Øst\"}"));
+
+            TSharedPtr<FJsonObject> Response = ParseObject(FMCPResponse::ToolCallSuccess(MakeShared<FJsonValueString>(TEXT("a")), ToolResult));
+            if (TestTrue("Parsed", Response.IsValid()))
+            {
+                TestEqual("id", Response->GetStringField(TEXT("id")), TEXT("a"));
+                const TSharedPtr<FJsonObject> Result = Response->GetObjectField(TEXT("result"));
+                TestFalse("isError", Result->GetBoolField(TEXT("isError")));
+                const TArray<TSharedPtr<FJsonValue>>& Content = Result->GetArrayField(TEXT("content"));
+                if (TestEqual("One content item", Content.Num(), 1))
+                {
+                    TestEqual("text", Content[0]->AsObject()->GetStringField(TEXT("text")), TEXT("{\"label\":\"Øst\"}"));
+                }
+            }
+        });
+    });
+}
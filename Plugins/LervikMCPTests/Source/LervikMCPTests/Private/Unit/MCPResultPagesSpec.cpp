@@ -0,0 +1,166 @@
+#include "Misc/AutomationTest.h"
+#include "MCPResultPages.h"
+#include "MCPSession.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+BEGIN_DEFINE_SPEC(FMCPResultPagesSpec, "Plugins.LervikMCP.ResultPages",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+    /** Items 0..Count-1 as numbers; Written counts WriteItem calls. */
+    static FMCPResultList MakeList(const FString& ArrayField, int32 Count, TSharedPtr<int32> Written = nullptr)
+    {
+        TArray<int32> Handles;
+        for (int32 i = 0; i < Count; ++i)
+        {
+            Handles.Add(i);
+        }
+        return FMCPResultList::FromHandles(ArrayField, MoveTemp(Handles), [Written](int32 Handle) -> TSharedPtr<FJsonValue>
+        {
+            if (Written.IsValid())
+            {
+                ++*Written;
+            }
+            return MakeShared<FJsonValueNumber>(Handle);
+        });
+    }
+
+    static FMCPToolResult MakeFirstPage(FMCPResultList&& List, int32 PageSize, const FString& Tool = TEXT("find"))
+    {
+        return FMCPResultPages::Get().MakeFirstPage(FMCPToolContext(), Tool, MoveTemp(List), PageSize);
+    }
+
+    static TSharedPtr<FJsonObject> ParseResult(const FMCPToolResult& Result)
+    {
+        TSharedPtr<FJsonObject> Object;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Result.GetText());
+        FJsonSerializer::Deserialize(Reader, Object);
+        return Object;
+    }
+
+    static TSharedPtr<FJsonObject> MakeCursorParams(const FString& Cursor)
+    {
+        TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+        Params->SetStringField(TEXT("cursor"), Cursor);
+        return Params;
+    }
+
+    /** Serves Cursor to Tool; tests run on the game thread, so the page is ready at once. */
+    bool ServeCursor(const FString& Cursor, FMCPToolResult& OutResult, const FString& Tool = TEXT("find"))
+    {
+        TFuture<FMCPToolResult> Future;
+        if (!FMCPResultPages::Get().TryServeCursor(MakeCursorParams(Cursor), FMCPToolContext(), Tool, Future))
+        {
+            return false;
+        }
+        OutResult = Future.Get();
+        return true;
+    }
+
+END_DEFINE_SPEC(FMCPResultPagesSpec)
+
+void FMCPResultPagesSpec::Define()
+{
+    It("Returns everything without a cursor when it fits one page", [this]()
+    {
+        const TSharedPtr<FJsonObject> Page = ParseResult(MakeFirstPage(MakeList(TEXT("results"), 3), 10));
+        if (!TestTrue("Parsed", Page.IsValid())) return;
+        TestEqual("count", (int32)Page->GetNumberField(TEXT("count")), 3);
+        TestEqual("total", (int32)Page->GetNumberField(TEXT("total")), 3);
+        TestFalse("No next_cursor", Page->HasField(TEXT("next_cursor")));
+        TestFalse("Not truncated", Page->HasField(TEXT("truncated")));
+    });
+
+    It("Serves later pages from the snapshot until the last one", [this]()
+    {
+        FMCPResultList List = MakeList(TEXT("nodes"), 5);
+        List.Envelope = MakeShared<FJsonObject>();
+        List.Envelope->SetStringField(TEXT("target"), TEXT("BP_Test"));
+
+        const TSharedPtr<FJsonObject> First = ParseResult(MakeFirstPage(MoveTemp(List), 2));
+        if (!TestTrue("Parsed", First.IsValid())) return;
+        TestEqual("First count", (int32)First->GetNumberField(TEXT("count")), 2);
+        TestEqual("First total", (int32)First->GetNumberField(TEXT("total")), 5);
+        TestEqual("Envelope kept", First->GetStringField(TEXT("target")), TEXT("BP_Test"));
+
+        FString Cursor;
+        if (!TestTrue("Has next_cursor", First->TryGetStringField(TEXT("next_cursor"), Cursor))) return;
+
+        FMCPToolResult SecondResult;
+        TestTrue("Cursor handled", ServeCursor(Cursor, SecondResult));
+        TestFalse("Not an error", SecondResult.bIsError);
+        const TSharedPtr<FJsonObject> Second = ParseResult(SecondResult);
+        if (!TestTrue("Parsed second", Second.IsValid())) return;
+        const TArray<TSharedPtr<FJsonValue>>& SecondItems = Second->GetArrayField(TEXT("nodes"));
+        if (!TestEqual("Second count", SecondItems.Num(), 2)) return;
+        TestEqual("Second starts after first", (int32)SecondItems[0]->AsNumber(), 2);
+
+        FMCPToolResult Again;
+        ServeCursor(Cursor, Again);
+        TestEqual("Same cursor, same page", Again.GetText(), SecondResult.GetText());
+
+        FString LastCursor;
+        if (!TestTrue("Has second next_cursor", Second->TryGetStringField(TEXT("next_cursor"), LastCursor))) return;
+        FMCPToolResult LastResult;
+        ServeCursor(LastCursor, LastResult);
+        const TSharedPtr<FJsonObject> Last = ParseResult(LastResult);
+        if (!TestTrue("Parsed last", Last.IsValid())) return;
+        TestEqual("Last count", (int32)Last->GetNumberField(TEXT("count")), 1);
+        TestFalse("Last page has no next_cursor", Last->HasField(TEXT("next_cursor")));
+    });
+
+    It("Writes only the items on returned pages", [this]()
+    {
+        TSharedPtr<int32> Written = MakeShared<int32>(0);
+        const TSharedPtr<FJsonObject> First = ParseResult(MakeFirstPage(MakeList(TEXT("results"), 1000, Written), 10));
+        if (!TestTrue("Parsed", First.IsValid())) return;
+        TestEqual("First page written", *Written, 10);
+
+        FMCPToolResult Second;
+        ServeCursor(First->GetStringField(TEXT("next_cursor")), Second);
+        TestEqual("Second page written", *Written, 20);
+    });
+
+    It("Reports truncated lists", [this]()
+    {
+        FMCPResultList List = MakeList(TEXT("results"), 3);
+        List.bTruncated = true;
+        const TSharedPtr<FJsonObject> Page = ParseResult(MakeFirstPage(MoveTemp(List), 10));
+        if (!TestTrue("Parsed", Page.IsValid())) return;
+        TestTrue("truncated", Page->GetBoolField(TEXT("truncated")));
+    });
+
+    It("Rejects unknown cursors and ignores requests without one", [this]()
+    {
+        FMCPToolResult Result;
+        TestTrue("Cursor handled", ServeCursor(TEXT("nope.2"), Result));
+        TestTrue("Is error", Result.bIsError);
+
+        TFuture<FMCPToolResult> Future;
+        TestFalse("No cursor", FMCPResultPages::Get().TryServeCursor(MakeShared<FJsonObject>(), FMCPToolContext(), TEXT("find"), Future));
+    });
+
+    It("Serves a cursor only to the tool and session it was issued to", [this]()
+    {
+        const TSharedPtr<FJsonObject> First = ParseResult(MakeFirstPage(MakeList(TEXT("results"), 5), 2));
+        if (!TestTrue("Parsed", First.IsValid())) return;
+        const FString Cursor = First->GetStringField(TEXT("next_cursor"));
+
+        FMCPToolResult OtherTool;
+        ServeCursor(Cursor, OtherTool, TEXT("inspect"));
+        TestTrue("Other tool rejected", OtherTool.bIsError);
+
+        {
+            FMCPSession Info;
+            Info.SessionId = FGuid::NewGuid();
+            FMCPSessionScope SessionScope(MakeShared<FMCPSessionState, ESPMode::ThreadSafe>(Info, false));
+            FMCPToolResult OtherSession;
+            ServeCursor(Cursor, OtherSession);
+            TestTrue("Other session rejected", OtherSession.bIsError);
+        }
+
+        FMCPToolResult Same;
+        ServeCursor(Cursor, Same);
+        TestFalse("Issuing session and tool served", Same.bIsError);
+    });
+}
@@ -0,0 +1,78 @@
+#include "Misc/AutomationTest.h"
+#include "MCPSearchPatterns.h"
+
+BEGIN_DEFINE_SPEC(FMCPSearchPatternsSpec, "Plugins.LervikMCP.SearchPatterns",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+END_DEFINE_SPEC(FMCPSearchPatternsSpec)
+
+void FMCPSearchPatternsSpec::Define()
+{
+    Describe("FMCPCompiledPattern", [this]()
+    {
+        It("Empty pattern matches everything", [this]()
+        {
+            FMCPCompiledPattern Pattern;
+            TestTrue("Is empty", Pattern.IsEmpty());
+            TestTrue("Matches", Pattern.Matches(TEXT("Anything")));
+            TestTrue("Compiled empty matches", FMCPSearchPatterns::Compile(TEXT("")).Matches(TEXT("Anything")));
+        });
+
+        It("Matches wildcards case-insensitively", [this]()
+        {
+            const FMCPCompiledPattern Pattern = FMCPSearchPatterns::Compile(TEXT("m_*"));
+            TestTrue("Prefix", Pattern.Matches(TEXT("M_Brick")));
+            TestFalse("No match", Pattern.Matches(TEXT("T_Brick")));
+
+            const FMCPCompiledPattern Single = FMCPSearchPatterns::Compile(TEXT("BP_?oor"));
+            TestTrue("Single char", Single.Matches(TEXT("BP_Door")));
+            TestFalse("Single char needs one char", Single.Matches(TEXT("BP_oor")));
+        });
+
+        It("Treats a plain word as a substring", [this]()
+        {
+            const FMCPCompiledPattern Pattern = FMCPSearchPatterns::Compile(TEXT("light"));
+            TestTrue("Substring", Pattern.Matches(TEXT("PointLightComponent")));
+            TestFalse("No match", Pattern.Matches(TEXT("StaticMesh")));
+        });
+
+        It("Supports comma OR and /regex/", [this]()
+        {
+            const FMCPCompiledPattern Alternation = FMCPSearchPatterns::Compile(TEXT("M_*, T_*"));
+            TestTrue("First", Alternation.Matches(TEXT("M_Rock")));
+            TestTrue("Second", Alternation.Matches(TEXT("T_Rock")));
+            TestFalse("Neither", Alternation.Matches(TEXT("SM_Rock")));
+
+            const FMCPCompiledPattern Regex = FMCPSearchPatterns::Compile(TEXT("/^SM_\\d+$/"));
+            TestTrue("Regex match", Regex.Matches(TEXT("SM_42")));
+            TestFalse("Regex no match", Regex.Matches(TEXT("SM_Rock")));
+        });
+
+        It("Matches inner wildcards and '|' alternatives", [this]()
+        {
+            const FMCPCompiledPattern Inner = FMCPSearchPatterns::Compile(TEXT("m*brick"));
+            TestTrue("Inner star", Inner.Matches(TEXT("SM_Wall_Brick_01")));
+            TestFalse("Order matters", Inner.Matches(TEXT("Brick_M")));
+
+            const FMCPCompiledPattern Pipe = FMCPSearchPatterns::Compile(TEXT("Rock|Tree"));
+            TestTrue("Pipe first", Pipe.Matches(TEXT("SM_Rock")));
+            TestTrue("Pipe second", Pipe.Matches(TEXT("SM_Tree")));
+            TestFalse("Pipe neither", Pipe.Matches(TEXT("SM_Bush")));
+
+            TestTrue("Lone star matches all", FMCPSearchPatterns::Compile(TEXT("*")).Matches(TEXT("x")));
+            TestTrue("Backtracks past partial match", FMCPSearchPatterns::Compile(TEXT("ab?d")).Matches(TEXT("aabcabxd")));
+        });
+
+        It("Keeps regex patterns that differ only by case apart", [this]()
+        {
+            TestTrue("\\d matches digit", FMCPSearchPatterns::Compile(TEXT("/^\\d$/")).Matches(TEXT("7")));
+            TestFalse("\\D does not match digit", FMCPSearchPatterns::Compile(TEXT("/^\\D$/")).Matches(TEXT("7")));
+        });
+    });
+
+    It("FilterStrings keeps matching values in order", [this]()
+    {
+        const TArray<FString> Values = { TEXT("M_A"), TEXT("T_B"), TEXT("M_C") };
+        const TArray<FString> Filtered = FMCPSearchPatterns::FilterStrings(Values, TEXT("M_*"));
+        TestTrue("Filtered", Filtered == TArray<FString>({ TEXT("M_A"), TEXT("M_C") }));
+    });
+}
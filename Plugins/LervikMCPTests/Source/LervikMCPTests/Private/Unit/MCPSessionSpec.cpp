@@ -1,5 +1,6 @@
 #include "Misc/AutomationTest.h"
 #include "MCPSession.h"
+#include "Async/ParallelFor.h"
 
 BEGIN_DEFINE_SPEC(FMCPSessionSpec, "Plugins.LervikMCP.Session",
     EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
@@ -42,6 +43,21 @@ void FMCPSessionSpec::Define()
             TestTrue("CreatedAt >= Before", Session.CreatedAt >= Before);
             TestTrue("CreatedAt <= After", Session.CreatedAt <= After);
         });
+
+        It("Creates a separate session per call", [this]()
+        {
+            FMCPSession First = SessionManager->CreateSession(TEXT("Client1"), TEXT("1.0"), TEXT("2024-11-05"));
+            FMCPSession Second = SessionManager->CreateSession(TEXT("Client2"), TEXT("2.0"), TEXT("2024-11-05"));
+
+            TestNotEqual("Different session IDs", First.SessionId, Second.SessionId);
+            TestEqual("Both live", SessionManager->Num(), 2);
+
+            FMCPSessionStatePtr FirstState = SessionManager->FindSession(First.SessionId);
+            if (TestTrue("First still found", FirstState.IsValid()))
+            {
+                TestEqual("First keeps its client", FirstState->GetInfo().ClientName, TEXT("Client1"));
+            }
+        });
     });
 
     Describe("HasSession", [this]()
@@ -58,58 +74,188 @@ void FMCPSessionSpec::Define()
         });
     });
 
-    Describe("GetSession", [this]()
+    Describe("FindSession", [this]()
     {
-        It("Returns nullptr when no session exists", [this]()
+        It("Returns null for an unknown ID", [this]()
         {
-            TestNull("No session", SessionManager->GetSession());
+            TestFalse("No session", SessionManager->FindSession(FGuid::NewGuid()).IsValid());
         });
 
-        It("Returns pointer to current session", [this]()
+        It("Returns the created session", [this]()
         {
             FMCPSession Created = SessionManager->CreateSession(TEXT("Client"), TEXT("1.0"), TEXT("2024-11-05"));
-            const FMCPSession* Retrieved = SessionManager->GetSession();
-            TestNotNull("Has session", Retrieved);
-            TestEqual("Same ID", Retrieved->SessionId, Created.SessionId);
+            FMCPSessionStatePtr Found = SessionManager->FindSession(Created.SessionId);
+            if (TestTrue("Has session", Found.IsValid()))
+            {
+                TestEqual("Same ID", Found->GetInfo().SessionId, Created.SessionId);
+            }
+        });
+
+        It("Finds every session under concurrent lookups", [this]()
+        {
+            TArray<FGuid> Ids;
+            for (int32 i = 0; i < 64; ++i)
+            {
+                Ids.Add(SessionManager->CreateSession(TEXT("Client"), TEXT("1.0"), TEXT("2024-11-05")).SessionId);
+            }
+
+            TAtomic<int32> Misses { 0 };
+            ParallelFor(Ids.Num() * 16, [&](int32 i)
+            {
+                if (!SessionManager->FindSession(Ids[i % Ids.Num()]).IsValid())
+                {
+                    ++Misses;
+                }
+            });
+            TestEqual("No misses", Misses.Load(), 0);
         });
     });
 
     Describe("DestroySession", [this]()
     {
-        It("Clears the current session", [this]()
+        It("Removes only that session", [this]()
         {
-            SessionManager->CreateSession(TEXT("Client"), TEXT("1.0"), TEXT("2024-11-05"));
-            SessionManager->DestroySession();
+            FMCPSession Kept = SessionManager->CreateSession(TEXT("Kept"), TEXT("1.0"), TEXT("2024-11-05"));
+            FMCPSession Dropped = SessionManager->CreateSession(TEXT("Dropped"), TEXT("1.0"), TEXT("2024-11-05"));
+
+            TestTrue("Destroyed", SessionManager->DestroySession(Dropped.SessionId));
+            TestFalse("Second destroy is a no-op", SessionManager->DestroySession(Dropped.SessionId));
+            TestFalse("Dropped is gone", SessionManager->FindSession(Dropped.SessionId).IsValid());
+            TestTrue("Kept is still there", SessionManager->FindSession(Kept.SessionId).IsValid());
+            TestEqual("One left", SessionManager->Num(), 1);
+        });
+
+        It("DestroyAllSessions clears everything", [this]()
+        {
+            SessionManager->CreateSession(TEXT("Client1"), TEXT("1.0"), TEXT("2024-11-05"));
+            SessionManager->CreateSession(TEXT("Client2"), TEXT("1.0"), TEXT("2024-11-05"));
+            SessionManager->DestroyAllSessions();
             TestFalse("No session", SessionManager->HasSession());
-            TestNull("Null pointer", SessionManager->GetSession());
+            TestEqual("Empty", SessionManager->GetSessions().Num(), 0);
         });
     });
 
-    Describe("Session idempotency", [this]()
+    Describe("Idle eviction", [this]()
     {
-        It("CreateSession returns existing session if one exists", [this]()
+        It("Drops idle sessions but keeps pinned and recently used ones", [this]()
         {
-            FMCPSession First = SessionManager->CreateSession(TEXT("Client1"), TEXT("1.0"), TEXT("2024-11-05"));
-            FMCPSession Second = SessionManager->CreateSession(TEXT("Client2"), TEXT("2.0"), TEXT("2024-11-05"));
+            FMCPSession Idle = SessionManager->CreateSession(TEXT("Idle"), TEXT("1.0"), TEXT("2024-11-05"));
+            FMCPSession Pinned = SessionManager->CreateSession(TEXT("Pinned"), TEXT("1.0"), TEXT("2024-11-05"), true);
+            FPlatformProcess::Sleep(0.05f);
+            FMCPSession Fresh = SessionManager->CreateSession(TEXT("Fresh"), TEXT("1.0"), TEXT("2024-11-05"));
 
-            TestTrue("Has session", SessionManager->HasSession());
-            TestEqual("Same session ID", First.SessionId, Second.SessionId);
+            TestEqual("One evicted", SessionManager->EvictIdleSessions(0.02), 1);
+            TestFalse("Idle gone", SessionManager->FindSession(Idle.SessionId).IsValid());
+            TestTrue("Pinned kept", SessionManager->FindSession(Pinned.SessionId).IsValid());
+            TestTrue("Fresh kept", SessionManager->FindSession(Fresh.SessionId).IsValid());
+        });
+    });
 
-            const FMCPSession* Current = SessionManager->GetSession();
-            TestEqual("Still original client", Current->ClientName, TEXT("Client1"));
+    Describe("Rate limit", [this]()
+    {
+        It("Allows a burst, then refuses until tokens refill", [this]()
+        {
+            FMCPSession Session = SessionManager->CreateSession(TEXT("Client"), TEXT("1.0"), TEXT("2024-11-05"));
+            FMCPSessionStatePtr State = SessionManager->FindSession(Session.SessionId);
+            if (!TestTrue("Has session", State.IsValid())) return;
+
+            // 1 token per 100 s: only the burst is available within the test.
+            for (int32 i = 0; i < 3; ++i)
+            {
+                TestTrue(FString::Printf(TEXT("Burst call %d"), i), State->TryConsumeCall(0.01, 3.0));
+            }
+            TestFalse("Over the limit", State->TryConsumeCall(0.01, 3.0));
+            TestTrue("Unlimited when rate is 0", State->TryConsumeCall(0.0, 3.0));
         });
 
-        It("GuidMap not reset on re-create", [this]()
+        It("Limits each session separately", [this]()
+        {
+            FMCPSessionStatePtr A = SessionManager->FindSession(SessionManager->CreateSession(TEXT("A"), TEXT("1.0"), TEXT("2024-11-05")).SessionId);
+            FMCPSessionStatePtr B = SessionManager->FindSession(SessionManager->CreateSession(TEXT("B"), TEXT("1.0"), TEXT("2024-11-05")).SessionId);
+            if (!TestTrue("Both exist", A.IsValid() && B.IsValid())) return;
+
+            TestTrue("A first call", A->TryConsumeCall(0.01, 1.0));
+            TestFalse("A limited", A->TryConsumeCall(0.01, 1.0));
+            TestTrue("B unaffected", B->TryConsumeCall(0.01, 1.0));
+        });
+    });
+
+    Describe("Compact GUIDs", [this]()
+    {
+        It("Round-trips outside any session", [this]()
         {
-            SessionManager->CreateSession(TEXT("Client"), TEXT("1.0"), TEXT("2024-11-05"));
             FGuid TestGuid = FGuid::NewGuid();
             FString Compact = SessionManager->GuidToCompact(TestGuid);
             TestFalse("Compact not empty", Compact.IsEmpty());
+            TestEqual("Round-trip", SessionManager->CompactToGuid(Compact), TestGuid);
+        });
+
+        It("Keeps a separate namespace per session", [this]()
+        {
+            FMCPSessionStatePtr A = SessionManager->FindSession(SessionManager->CreateSession(TEXT("A"), TEXT("1.0"), TEXT("2024-11-05")).SessionId);
+            FMCPSessionStatePtr B = SessionManager->FindSession(SessionManager->CreateSession(TEXT("B"), TEXT("1.0"), TEXT("2024-11-05")).SessionId);
+            if (!TestTrue("Both exist", A.IsValid() && B.IsValid())) return;
+
+            const FGuid GuidA = FGuid::NewGuid();
+            const FGuid GuidB = FGuid::NewGuid();
+            FString CompactA;
+            FString CompactB;
+            {
+                FMCPSessionScope Scope(A);
+                CompactA = SessionManager->GuidToCompact(GuidA);
+            }
+            {
+                FMCPSessionScope Scope(B);
+                CompactB = SessionManager->GuidToCompact(GuidB);
+                TestEqual("Both start at the same short ID", CompactB, CompactA);
+                TestEqual("B resolves its own GUID", SessionManager->CompactToGuid(CompactB), GuidB);
+            }
+            {
+                FMCPSessionScope Scope(A);
+                TestEqual("A still resolves its own GUID", SessionManager->CompactToGuid(CompactA), GuidA);
+            }
+        });
+
+        It("ResetGuidMap only affects the current session", [this]()
+        {
+            FMCPSessionStatePtr A = SessionManager->FindSession(SessionManager->CreateSession(TEXT("A"), TEXT("1.0"), TEXT("2024-11-05")).SessionId);
+            FMCPSessionStatePtr B = SessionManager->FindSession(SessionManager->CreateSession(TEXT("B"), TEXT("1.0"), TEXT("2024-11-05")).SessionId);
+            if (!TestTrue("Both exist", A.IsValid() && B.IsValid())) return;
+
+            const FGuid Guid = FGuid::NewGuid();
+            FString CompactA;
+            FString CompactB;
+            {
+                FMCPSessionScope Scope(A);
+                CompactA = SessionManager->GuidToCompact(Guid);
+            }
+            {
+                FMCPSessionScope Scope(B);
+                CompactB = SessionManager->GuidToCompact(Guid);
+                SessionManager->ResetGuidMap();
+                TestFalse("B forgot", SessionManager->CompactToGuid(CompactB).IsValid());
+            }
+            {
+                FMCPSessionScope Scope(A);
+                TestEqual("A remembers", SessionManager->CompactToGuid(CompactA), Guid);
+            }
+        });
+
+        It("Restores the outer scope when a nested one ends", [this]()
+        {
+            FMCPSessionStatePtr A = SessionManager->FindSession(SessionManager->CreateSession(TEXT("A"), TEXT("1.0"), TEXT("2024-11-05")).SessionId);
+            FMCPSessionStatePtr B = SessionManager->FindSession(SessionManager->CreateSession(TEXT("B"), TEXT("1.0"), TEXT("2024-11-05")).SessionId);
 
-            // Second create should not reset the guid map
-            SessionManager->CreateSession(TEXT("Client2"), TEXT("2.0"), TEXT("2024-11-05"));
-            FGuid Recovered = SessionManager->CompactToGuid(Compact);
-            TestEqual("GuidMap preserved", Recovered, TestGuid);
+            TestFalse("No session outside a scope", FMCPSessionScope::GetCurrent().IsValid());
+            {
+                FMCPSessionScope Outer(A);
+                {
+                    FMCPSessionScope Inner(B);
+                    TestTrue("Inner is current", FMCPSessionScope::GetCurrent() == B);
+                }
+                TestTrue("Outer is current again", FMCPSessionScope::GetCurrent() == A);
+            }
+            TestFalse("Cleared after the outer scope", FMCPSessionScope::GetCurrent().IsValid());
         });
     });
 }
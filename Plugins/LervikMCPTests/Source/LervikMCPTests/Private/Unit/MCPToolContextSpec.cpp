@@ -0,0 +1,61 @@
+#include "Misc/AutomationTest.h"
+#include "MCPToolContext.h"
+
+BEGIN_DEFINE_SPEC(FMCPToolContextSpec, "Plugins.LervikMCP.ToolContext",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+END_DEFINE_SPEC(FMCPToolContextSpec)
+
+void FMCPToolContextSpec::Define()
+{
+    It("Default context ignores progress and cancellation", [this]()
+    {
+        FMCPToolContext Context;
+        TestFalse("No progress", Context.WantsProgress());
+        Context.ReportProgress(1, 2, TEXT("ignored"));
+        Context.Cancel();
+        TestFalse("Not cancelled", Context.IsCancelled());
+    });
+
+    It("Forwards progress to the handler", [this]()
+    {
+        double LastProgress = 0.0;
+        double LastTotal = 0.0;
+        FString LastMessage;
+        FMCPToolContext Context([&](double Progress, double Total, const FString& Message)
+        {
+            LastProgress = Progress;
+            LastTotal = Total;
+            LastMessage = Message;
+        });
+
+        TestTrue("Wants progress", Context.WantsProgress());
+        Context.ReportProgress(3, 4, TEXT("step"));
+        TestEqual("Progress", LastProgress, 3.0);
+        TestEqual("Total", LastTotal, 4.0);
+        TestEqual("Message", LastMessage, TEXT("step"));
+    });
+
+    It("Copies share cancellation", [this]()
+    {
+        FMCPToolContext Context{ FMCPToolContext::FProgressHandler() };
+        FMCPToolContext Copy = Context;
+        TestFalse("No progress without handler", Context.WantsProgress());
+        TestFalse("Not cancelled yet", Copy.IsCancelled());
+
+        Context.Cancel();
+        TestTrue("Copy sees cancellation", Copy.IsCancelled());
+        TestTrue("Same call", Copy == Context);
+    });
+
+    It("Copies carry the session given at construction", [this]()
+    {
+        FMCPSession Info;
+        Info.SessionId = FGuid::NewGuid();
+        FMCPSessionStatePtr Session = MakeShared<FMCPSessionState, ESPMode::ThreadSafe>(Info, false);
+
+        FMCPToolContext Context(FMCPToolContext::FProgressHandler(), Session);
+        FMCPToolContext Copy = Context;
+        TestTrue("Session kept", Copy.GetSession() == Session);
+        TestFalse("Default context has none", FMCPToolContext().GetSession().IsValid());
+    });
+}
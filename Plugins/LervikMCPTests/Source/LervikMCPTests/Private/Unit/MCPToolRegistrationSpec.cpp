@@ -1,5 +1,6 @@
 #include "Misc/AutomationTest.h"
 #include "IMCPTool.h"
+#include "MCPToolRegistry.h"
 #include "Features/IModularFeatures.h"
 
 // Mock tool for testing
@@ -87,6 +88,14 @@ void FMCPToolRegistrationSpec::Define()
             TestFalse("Not error", Result.bIsError);
         });
 
+        It("ExecuteAsync defaults to a ready future of Execute", [this]()
+        {
+            MockTool->ResultToReturn = FMCPToolResult::Text(TEXT("async result"));
+            TFuture<FMCPToolResult> Future = MockTool->ExecuteAsync(nullptr, FMCPToolContext());
+            TestTrue("Ready", Future.IsReady());
+            TestEqual("Content", Future.Get().Content, TEXT("async result"));
+        });
+
         It("Can unregister a tool", [this]()
         {
             IModularFeatures::Get().RegisterModularFeature(IMCPTool::GetModularFeatureName(), MockTool.Get());
@@ -109,4 +118,48 @@ void FMCPToolRegistrationSpec::Define()
             TestEqual("Count", Tools.Num(), BaselineToolCount + 2);
         });
     });
+
+    Describe("FMCPToolRegistry", [this]()
+    {
+        It("Finds a registered tool by name", [this]()
+        {
+            FMCPToolRegistry Registry;
+            Registry.Initialize();
+            IModularFeatures::Get().RegisterModularFeature(IMCPTool::GetModularFeatureName(), MockTool.Get());
+
+            TestTrue("Found by FString", Registry.FindTool(FString(TEXT("mock_tool"))) == MockTool.Get());
+            TestTrue("Found by FName", Registry.FindTool(FName(TEXT("mock_tool"))) == MockTool.Get());
+            TestNull("Unknown name", Registry.FindTool(FString(TEXT("mock_tool_that_does_not_exist"))));
+        });
+
+        It("Drops a tool after it is unregistered", [this]()
+        {
+            FMCPToolRegistry Registry;
+            Registry.Initialize();
+            IModularFeatures::Get().RegisterModularFeature(IMCPTool::GetModularFeatureName(), MockTool.Get());
+            TestNotNull("Found before unregister", Registry.FindTool(FString(TEXT("mock_tool"))));
+
+            const uint32 GenerationBefore = Registry.GetGeneration();
+            IModularFeatures::Get().UnregisterModularFeature(IMCPTool::GetModularFeatureName(), MockTool.Get());
+
+            TestNotEqual("Generation bumped", Registry.GetGeneration(), GenerationBefore);
+            TestNull("Not found after unregister", Registry.FindTool(FString(TEXT("mock_tool"))));
+        });
+
+        It("Lists tools in registration order", [this]()
+        {
+            FMCPToolRegistry Registry;
+            Registry.Initialize();
+            IModularFeatures::Get().RegisterModularFeature(IMCPTool::GetModularFeatureName(), MockTool.Get());
+            IModularFeatures::Get().RegisterModularFeature(IMCPTool::GetModularFeatureName(), MockTool2.Get());
+
+            TArray<FMCPToolInfo> Infos = Registry.GetToolInfos();
+            TestEqual("Count", Infos.Num(), BaselineToolCount + 2);
+            if (Infos.Num() >= 2)
+            {
+                TestEqual("Second to last", Infos[Infos.Num() - 2].Name, FName(TEXT("mock_tool")));
+                TestEqual("Last", Infos.Last().Name, FName(TEXT("mock_tool_2")));
+            }
+        });
+    });
 }
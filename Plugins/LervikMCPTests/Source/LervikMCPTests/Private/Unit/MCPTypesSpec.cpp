@@ -189,6 +189,109 @@ void FMCPTypesSpec::Define()
         });
     });
 
+    Describe("FMCPRequest::ParseMessage", [this]()
+    {
+        It("Parses a single object as a non-batch request", [this]()
+        {
+            TArray<FMCPRequest> Requests;
+            bool bIsBatch = true;
+            FString Error;
+            bool bOk = FMCPRequest::ParseMessage(
+                TEXT("{\"jsonrpc\":\"2.0\",\"method\":\"ping\",\"id\":1}"),
+                Requests, bIsBatch, Error);
+            TestTrue("Parse succeeded", bOk);
+            TestFalse("Not a batch", bIsBatch);
+            TestEqual("One request", Requests.Num(), 1);
+        });
+
+        It("Parses a batch array in order", [this]()
+        {
+            TArray<FMCPRequest> Requests;
+            bool bIsBatch = false;
+            FString Error;
+            bool bOk = FMCPRequest::ParseMessage(
+                TEXT("[{\"jsonrpc\":\"2.0\",\"method\":\"ping\",\"id\":1},")
+                TEXT("{\"jsonrpc\":\"2.0\",\"method\":\"notifications/initialized\"},")
+                TEXT("{\"jsonrpc\":\"2.0\",\"method\":\"tools/list\",\"id\":\"b\"}]"),
+                Requests, bIsBatch, Error);
+            TestTrue("Parse succeeded", bOk);
+            TestTrue("Is batch", bIsBatch);
+            TestEqual("Three entries", Requests.Num(), 3);
+            if (Requests.Num() == 3)
+            {
+                TestEqual("First method", Requests[0].Method, TEXT("ping"));
+                TestTrue("Second is notification", Requests[1].bIsNotification);
+                TestEqual("Third method", Requests[2].Method, TEXT("tools/list"));
+            }
+        });
+
+        It("Marks invalid batch entries without failing the batch", [this]()
+        {
+            TArray<FMCPRequest> Requests;
+            bool bIsBatch = false;
+            FString Error;
+            bool bOk = FMCPRequest::ParseMessage(
+                TEXT("[1,{\"method\":\"ping\",\"id\":7},{\"jsonrpc\":\"2.0\",\"method\":\"ping\",\"id\":8}]"),
+                Requests, bIsBatch, Error);
+            TestTrue("Parse succeeded", bOk);
+            TestEqual("Three entries", Requests.Num(), 3);
+            if (Requests.Num() == 3)
+            {
+                TestFalse("Non-object entry flagged", Requests[0].ParseError.IsEmpty());
+                TestFalse("Missing jsonrpc flagged", Requests[1].ParseError.IsEmpty());
+                TestTrue("Invalid entry keeps its id", Requests[1].Id.IsValid());
+                TestTrue("Valid entry not flagged", Requests[2].ParseError.IsEmpty());
+            }
+        });
+
+        It("Accepts an empty batch with no entries", [this]()
+        {
+            TArray<FMCPRequest> Requests;
+            bool bIsBatch = false;
+            FString Error;
+            bool bOk = FMCPRequest::ParseMessage(TEXT("[]"), Requests, bIsBatch, Error);
+            TestTrue("Parse succeeded", bOk);
+            TestTrue("Is batch", bIsBatch);
+            TestEqual("No entries", Requests.Num(), 0);
+        });
+
+        It("Parses a UTF-8 body in place, keeping non-ASCII text", [this]()
+        {
+            const FString Source = TEXT("{\"jsonrpc\":\"2.0\",\"method\":\"tools/call\",\"id\":3,\"params\":{\"name\":\"find\",\"arguments\":{\"query\":\"Blåbær_Øl\"}}}");
+            FTCHARToUTF8 Utf8(*Source, Source.Len());
+
+            TArray<FMCPRequest> Requests;
+            bool bIsBatch = true;
+            FString Error;
+            bool bOk = FMCPRequest::ParseMessage(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Utf8.Get()), Utf8.Length()), Requests, bIsBatch, Error);
+            TestTrue("Parse succeeded", bOk);
+            TestFalse("Not a batch", bIsBatch);
+            if (Requests.Num() == 1 && Requests[0].Params.IsValid())
+            {
+                TestEqual("Method", Requests[0].Method, TEXT("tools/call"));
+                const TSharedPtr<FJsonObject>* Arguments;
+                if (TestTrue("Has arguments", Requests[0].Params->TryGetObjectField(TEXT("arguments"), Arguments)))
+                {
+                    TestEqual("Non-ASCII query", (*Arguments)->GetStringField(TEXT("query")), FString(TEXT("Blåbær_Øl")));
+                }
+            }
+            else
+            {
+                AddError(TEXT("Expected one request with params"));
+            }
+        });
+
+        It("Rejects an invalid UTF-8 body", [this]()
+        {
+            TArray<FMCPRequest> Requests;
+            bool bIsBatch = false;
+            FString Error;
+            bool bOk = FMCPRequest::ParseMessage(FUtf8StringView(UTF8TEXTVIEW("{\"jsonrpc\":")), Requests, bIsBatch, Error);
+            TestFalse("Parse failed", bOk);
+            TestFalse("Error set", Error.IsEmpty());
+        });
+    });
+
     Describe("FMCPResponse", [this]()
     {
         It("Success() produces valid JSON-RPC response", [this]()
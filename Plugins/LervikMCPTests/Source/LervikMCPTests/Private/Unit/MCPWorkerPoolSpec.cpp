@@ -0,0 +1,111 @@
+#include "Misc/AutomationTest.h"
+#include "MCPWorkerPool.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "HAL/PlatformProcess.h"
+#include "Async/Async.h"
+
+BEGIN_DEFINE_SPEC(FMCPWorkerPoolSpec, "Plugins.LervikMCP.WorkerPool",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+    TUniquePtr<FMCPWorkerPool> Pool;
+END_DEFINE_SPEC(FMCPWorkerPoolSpec)
+
+void FMCPWorkerPoolSpec::Define()
+{
+    BeforeEach([this]()
+    {
+        Pool = MakeUnique<FMCPWorkerPool>();
+    });
+
+    AfterEach([this]()
+    {
+        Pool.Reset();
+    });
+
+    It("Rejects work when not started", [this]()
+    {
+        TestFalse("Not running", Pool->IsRunning());
+        TestFalse("Enqueue rejected", Pool->TryEnqueue([]() {}));
+    });
+
+    It("Runs queued work on worker threads", [this]()
+    {
+        TestTrue("Started", Pool->Start(2, 16));
+
+        FThreadSafeCounter Executed;
+        FThreadSafeCounter RanOnGameThread;
+        for (int32 i = 0; i < 8; ++i)
+        {
+            TestTrue("Enqueued", Pool->TryEnqueue([&Executed, &RanOnGameThread]()
+            {
+                if (IsInGameThread())
+                {
+                    RanOnGameThread.Increment();
+                }
+                Executed.Increment();
+            }));
+        }
+
+        const double Timeout = FPlatformTime::Seconds() + 5.0;
+        while (Executed.GetValue() < 8 && FPlatformTime::Seconds() < Timeout)
+        {
+            FPlatformProcess::Sleep(0.001f);
+        }
+
+        TestEqual("All work executed", Executed.GetValue(), 8);
+        TestEqual("Nothing ran on game thread", RanOnGameThread.GetValue(), 0);
+        TestEqual("Queue drained", Pool->GetQueueDepth(), 0);
+    });
+
+    It("Rejects work beyond the queue depth", [this]()
+    {
+        TestTrue("Started", Pool->Start(1, 2));
+
+        FEvent* Gate = FPlatformProcess::GetSynchEventFromPool(true);
+        FThreadSafeCounter Started;
+
+        // Occupy the only worker so subsequent items stay queued.
+        Pool->TryEnqueue([Gate, &Started]() { Started.Increment(); Gate->Wait(); });
+        const double Timeout = FPlatformTime::Seconds() + 5.0;
+        while (Started.GetValue() == 0 && FPlatformTime::Seconds() < Timeout)
+        {
+            FPlatformProcess::Sleep(0.001f);
+        }
+
+        TestTrue("First queued", Pool->TryEnqueue([]() {}));
+        TestTrue("Second queued", Pool->TryEnqueue([]() {}));
+        TestFalse("Third rejected", Pool->TryEnqueue([]() {}));
+        TestEqual("Queue depth", Pool->GetQueueDepth(), 2);
+
+        Gate->Trigger();
+        Pool->Stop();
+        FPlatformProcess::ReturnSynchEventToPool(Gate);
+    });
+
+    It("Runs OnAbandoned for work dropped by Stop", [this]()
+    {
+        TestTrue("Started", Pool->Start(1, 4));
+
+        FEvent* Gate = FPlatformProcess::GetSynchEventFromPool(true);
+        FThreadSafeCounter Started;
+        bool bRan = false;
+        bool bAbandoned = false;
+
+        // Occupy the only worker so the next item is still queued when the pool stops.
+        Pool->TryEnqueue([Gate, &Started]() { Started.Increment(); Gate->Wait(); });
+        const double Timeout = FPlatformTime::Seconds() + 5.0;
+        while (Started.GetValue() == 0 && FPlatformTime::Seconds() < Timeout)
+        {
+            FPlatformProcess::Sleep(0.001f);
+        }
+
+        TestTrue("Queued", Pool->TryEnqueue([&bRan]() { bRan = true; }, [&bAbandoned]() { bAbandoned = true; }));
+
+        // Release the worker from another thread once Stop() has had time to abandon the queue.
+        Async(EAsyncExecution::Thread, [Gate]() { FPlatformProcess::Sleep(0.1f); Gate->Trigger(); });
+        Pool->Stop();
+        FPlatformProcess::ReturnSynchEventToPool(Gate);
+
+        TestTrue("Abandon callback ran", bAbandoned);
+        TestFalse("Work did not run", bRan);
+    });
+}